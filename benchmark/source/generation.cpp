@@ -0,0 +1,127 @@
+#include <benchmark/benchmark.h>
+#include <genetic/genetic.h>
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+namespace {
+    using chromosome = std::array<double, 2>;
+
+    /// @brief Uniformly random parent selection, keeps selection cost out of the measurement.
+    struct uniform_random_selection {
+        template <std::ranges::random_access_range Range, typename UnaryOperator,
+                  typename T = std::ranges::range_value_t<Range>>
+        std::pair<T, T> operator()(Range population, UnaryOperator) const {
+            constexpr dp::genetic::uniform_integral_generator generator{};
+            const auto last = static_cast<std::size_t>(std::ranges::size(population)) - 1;
+            return {population[generator(std::size_t{0}, last)],
+                    population[generator(std::size_t{0}, last)]};
+        }
+    };
+
+    std::vector<chromosome> make_population(std::size_t size) {
+        dp::genetic::uniform_floating_point_generator generator{};
+        std::vector<chromosome> population(size);
+        for (auto& value : population) value = {generator(-1.0, 1.0), generator(-1.0, 1.0)};
+        return population;
+    }
+
+    /**
+     * @brief Runs solve() once per iteration and only times the generations after the first.
+     * @details Building and scoring the initial population and warming up the population buffers
+     * are not part of the cost of a generation, so the time is taken from the end of the first
+     * generation to the end of the last one.
+     */
+    template <typename Parameters>
+    void time_steady_state_generations(benchmark::State& state,
+                                       const std::vector<chromosome>& initial_population,
+                                       const dp::genetic::algorithm_settings& settings,
+                                       const Parameters& params, std::size_t generations) {
+        using clock = std::chrono::steady_clock;
+        for (auto _ : state) {
+            clock::time_point first_generation{};
+            clock::time_point last_generation{};
+            std::size_t generation{0};
+            auto result = dp::genetic::solve(initial_population, settings, params,
+                                             [&](const auto&) {
+                                                 last_generation = clock::now();
+                                                 if (generation++ == 0) {
+                                                     first_generation = last_generation;
+                                                 }
+                                             });
+            benchmark::DoNotOptimize(result);
+            state.SetIterationTime(
+                std::chrono::duration<double>(last_generation - first_generation).count());
+        }
+
+        state.counters["generation"] = benchmark::Counter(
+            static_cast<double>(generations - 1),
+            benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+    }
+}  // namespace
+
+static void generation_overhead(benchmark::State& state) {
+    const auto population_size = static_cast<std::size_t>(state.range(0));
+    constexpr std::size_t generations = 5;
+
+    const auto initial_population = make_population(population_size);
+    const auto fitness = [](const chromosome& value) { return value[0] + value[1]; };
+    const auto params =
+        dp::genetic::params<chromosome>::builder()
+            .with_fitness_operator(fitness)
+            .with_selection_operator<decltype(fitness)>(uniform_random_selection{})
+            .with_termination_operator(dp::genetic::generations_termination{generations + 1})
+            .build();
+
+    // every pair of parents is crossed over, so every child goes through all the operators
+    const dp::genetic::algorithm_settings settings{
+        .crossover_rate = 1.0, .chunk_size = static_cast<std::size_t>(state.range(1))};
+
+    time_steady_state_generations(state, initial_population, settings, params, generations);
+}
+
+// chunk size 0 picks the chunk size automatically, 1 is one task per pair of children
+BENCHMARK(generation_overhead)
+    ->ArgsProduct({{100, 10'000, 1'000'000}, {0, 1}})
+    ->ArgNames({"population", "chunk"})
+    ->Unit(benchmark::kMillisecond)
+    ->UseManualTime();
+
+static void generation_rates(benchmark::State& state) {
+    constexpr std::size_t population_size = 10'000;
+    constexpr std::size_t generations = 5;
+
+    const auto initial_population = make_population(population_size);
+    const auto params =
+        dp::genetic::params<chromosome>::builder()
+            .with_fitness_operator([](const chromosome& value) {
+                // stands in for an expensive fitness function
+                double sum{};
+                for (int i = 0; i < 64; ++i) sum += std::sin(value[0] * i) * std::cos(value[1]);
+                return sum;
+            })
+            .with_mutation_operator(dp::genetic::double_value_mutator(-0.01, 0.01))
+            .with_termination_operator(dp::genetic::generations_termination{generations + 1})
+            .build();
+
+    // children that are neither crossed over nor mutated keep the fitness of their parent
+    const auto rate = static_cast<double>(state.range(0)) / 100.0;
+    const dp::genetic::algorithm_settings settings{
+        .mutation_rate = rate, .crossover_rate = rate, .thread_count = 1, .seed = 42};
+
+    time_steady_state_generations(state, initial_population, settings, params, generations);
+}
+
+// crossover and mutation rate in percent
+BENCHMARK(generation_rates)
+    ->Arg(5)
+    ->Arg(50)
+    ->Arg(100)
+    ->ArgName("rate")
+    ->Unit(benchmark::kMillisecond)
+    ->UseManualTime();
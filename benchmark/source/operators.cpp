@@ -0,0 +1,387 @@
+#include <benchmark/benchmark.h>
+#include <genetic/bit_chromosome.h>
+#include <genetic/crossover.h>
+#include <genetic/fitness.h>
+#include <genetic/mutation.h>
+#include <genetic/selection.h>
+#include <genetic/termination.h>
+
+#include <cstddef>
+#include <deque>
+#include <numeric>
+#include <ranges>
+#include <string>
+#include <vector>
+
+namespace {
+    const std::string alphabet = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ!,. '";
+
+    std::string make_word(std::size_t length) {
+        dp::genetic::uniform_integral_generator generator{};
+        std::string word(length, '\0');
+        for (auto& value : word) value = alphabet[generator(std::size_t{0}, alphabet.size() - 1)];
+        return word;
+    }
+
+    std::vector<double> make_values(std::size_t size) {
+        dp::genetic::uniform_floating_point_generator generator{};
+        std::vector<double> values(size);
+        for (auto& value : values) value = generator(0.0, 1.0);
+        return values;
+    }
+
+    std::vector<int> make_mask(std::size_t size) {
+        dp::genetic::uniform_integral_generator generator{};
+        std::vector<int> mask(size);
+        for (auto& value : mask) value = generator(0, 1);
+        return mask;
+    }
+
+    std::vector<int> make_population(std::size_t size) {
+        std::vector<int> population(size);
+        std::iota(population.begin(), population.end(), 1);
+        return population;
+    }
+
+    constexpr auto identity_fitness = [](int value) { return static_cast<double>(value); };
+}  // namespace
+
+// ---- selection ----
+
+/// @brief Selects one pair of parents at a time, re-scanning the population for every pair.
+template <typename Selection>
+void selection_single_draw(benchmark::State& state) {
+    const auto population = make_population(static_cast<std::size_t>(state.range(0)));
+    Selection selection{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(selection(std::views::all(population), identity_fitness));
+    }
+}
+
+/// @brief Prepares the selection once per "generation" and draws enough pairs to refill it.
+template <typename Selection>
+void selection_generation(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto population = make_population(size);
+    const Selection selection{};
+    for (auto _ : state) {
+        const auto sampler = selection.prepare(population, identity_fitness);
+        for (std::size_t i = 0; i < size / 2; ++i) benchmark::DoNotOptimize(sampler());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(size / 2));
+}
+
+BENCHMARK_TEMPLATE(selection_single_draw, dp::genetic::roulette_selection)
+    ->RangeMultiplier(10)
+    ->Range(100, 100'000);
+BENCHMARK_TEMPLATE(selection_single_draw, dp::genetic::rank_selection)
+    ->RangeMultiplier(10)
+    ->Range(100, 100'000);
+BENCHMARK_TEMPLATE(selection_single_draw, dp::genetic::tournament_selection)
+    ->RangeMultiplier(10)
+    ->Range(100, 100'000);
+BENCHMARK_TEMPLATE(selection_generation, dp::genetic::roulette_selection)
+    ->RangeMultiplier(10)
+    ->Range(100, 100'000);
+BENCHMARK_TEMPLATE(selection_generation, dp::genetic::rank_selection)
+    ->RangeMultiplier(10)
+    ->Range(100, 100'000);
+BENCHMARK_TEMPLATE(selection_generation, dp::genetic::tournament_selection)
+    ->RangeMultiplier(10)
+    ->Range(100, 100'000);
+
+// ---- crossover ----
+
+static void crossover_random(benchmark::State& state) {
+    const auto length = static_cast<std::size_t>(state.range(0));
+    const auto first = make_word(length);
+    const auto second = make_word(length);
+    dp::genetic::random_crossover crossover{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(crossover(first, second));
+    }
+}
+BENCHMARK(crossover_random)->RangeMultiplier(8)->Range(8, 4096);
+
+// inclusion masks with one int per gene, the way binary problems are written without
+// bit_chromosome
+static void crossover_random_int_mask(benchmark::State& state) {
+    const auto length = static_cast<std::size_t>(state.range(0));
+    const auto first = make_mask(length);
+    const auto second = make_mask(length);
+    std::vector<int> child(length);
+    dp::genetic::random_crossover crossover{};
+    for (auto _ : state) {
+        crossover(first, second, child);
+        benchmark::DoNotOptimize(child.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(crossover_random_int_mask)->RangeMultiplier(8)->Range(64, 1 << 15);
+
+static void crossover_random_bits(benchmark::State& state) {
+    const auto length = static_cast<std::size_t>(state.range(0));
+    const dp::genetic::bit_chromosome<> first(make_mask(length));
+    const dp::genetic::bit_chromosome<> second(make_mask(length));
+    dp::genetic::bit_chromosome<> child(length);
+    dp::genetic::random_crossover crossover{};
+    for (auto _ : state) {
+        crossover(first, second, child);
+        benchmark::DoNotOptimize(child.words().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(crossover_random_bits)->RangeMultiplier(8)->Range(64, 1 << 15);
+
+static void crossover_uniform_bits(benchmark::State& state) {
+    const auto length = static_cast<std::size_t>(state.range(0));
+    const dp::genetic::bit_chromosome<> first(make_mask(length));
+    const dp::genetic::bit_chromosome<> second(make_mask(length));
+    dp::genetic::bit_chromosome<> child(length);
+    const dp::genetic::uniform_crossover crossover{};
+    for (auto _ : state) {
+        crossover(first, second, child);
+        benchmark::DoNotOptimize(child.words().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(crossover_uniform_bits)->RangeMultiplier(8)->Range(64, 1 << 15);
+
+namespace {
+    // both children of two real valued parents, written into existing chromosomes
+    template <typename Crossover>
+    void crossover_real_pair(benchmark::State& state, const Crossover& crossover) {
+        const auto length = static_cast<std::size_t>(state.range(0));
+        const auto first = make_values(length);
+        const auto second = make_values(length);
+        std::vector<double> first_child(length);
+        std::vector<double> second_child(length);
+        for (auto _ : state) {
+            crossover(first, second, first_child, second_child);
+            benchmark::DoNotOptimize(first_child.data());
+            benchmark::DoNotOptimize(second_child.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+    }
+}  // namespace
+
+static void crossover_uniform_pair(benchmark::State& state) {
+    crossover_real_pair(state, dp::genetic::uniform_crossover{});
+}
+BENCHMARK(crossover_uniform_pair)->RangeMultiplier(8)->Range(8, 1 << 15);
+
+// the same children made with one call per child, the way solve() calls other operators
+static void crossover_uniform_two_calls(benchmark::State& state) {
+    crossover_real_pair(state, [](const auto& first, const auto& second, auto& first_child,
+                                  auto& second_child) {
+        dp::genetic::uniform_crossover{}(first, second, first_child);
+        dp::genetic::uniform_crossover{}(second, first, second_child);
+    });
+}
+BENCHMARK(crossover_uniform_two_calls)->RangeMultiplier(8)->Range(8, 1 << 15);
+
+static void crossover_two_point_pair(benchmark::State& state) {
+    crossover_real_pair(state, dp::genetic::two_point_crossover{});
+}
+BENCHMARK(crossover_two_point_pair)->RangeMultiplier(8)->Range(8, 1 << 15);
+
+static void crossover_blend_pair(benchmark::State& state) {
+    crossover_real_pair(state, dp::genetic::blend_crossover{});
+}
+BENCHMARK(crossover_blend_pair)->RangeMultiplier(8)->Range(8, 1 << 15);
+
+static void crossover_arithmetic_pair(benchmark::State& state) {
+    crossover_real_pair(state, dp::genetic::arithmetic_crossover{});
+}
+BENCHMARK(crossover_arithmetic_pair)->RangeMultiplier(8)->Range(8, 1 << 15);
+
+static void crossover_simulated_binary_pair(benchmark::State& state) {
+    crossover_real_pair(state, dp::genetic::simulated_binary_crossover{});
+}
+BENCHMARK(crossover_simulated_binary_pair)->RangeMultiplier(8)->Range(8, 1 << 15);
+
+// ---- mutation ----
+
+static void mutation_value(benchmark::State& state) {
+    const auto chromosome = make_values(static_cast<std::size_t>(state.range(0)));
+    const auto mutator = dp::genetic::double_value_mutator(-0.1, 0.1);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(mutator(chromosome));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(mutation_value)->RangeMultiplier(8)->Range(8, 8192);
+
+// 8192 doubles is a 64 KB chromosome
+static void mutation_value_in_place(benchmark::State& state) {
+    auto chromosome = make_values(static_cast<std::size_t>(state.range(0)));
+    const auto mutator = dp::genetic::double_value_mutator(-0.1, 0.1);
+    for (auto _ : state) {
+        mutator(chromosome);
+        benchmark::DoNotOptimize(chromosome.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(mutation_value_in_place)->RangeMultiplier(8)->Range(8, 8192);
+
+static void mutation_value_replacement(benchmark::State& state) {
+    const auto chromosome = make_word(static_cast<std::size_t>(state.range(0)));
+    dp::genetic::value_replacement<std::string, dp::genetic::pooled_value_generator<std::string>>
+        mutator{dp::genetic::pooled_value_generator<std::string>{alphabet}};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(mutator(chromosome));
+    }
+}
+BENCHMARK(mutation_value_replacement)->RangeMultiplier(8)->Range(8, 1 << 16);
+
+static void mutation_value_replacement_in_place(benchmark::State& state) {
+    auto chromosome = make_word(static_cast<std::size_t>(state.range(0)));
+    dp::genetic::value_replacement<std::string, dp::genetic::pooled_value_generator<std::string>>
+        mutator{dp::genetic::pooled_value_generator<std::string>{alphabet}};
+    for (auto _ : state) {
+        mutator(chromosome);
+        benchmark::DoNotOptimize(chromosome.data());
+    }
+}
+BENCHMARK(mutation_value_replacement_in_place)->RangeMultiplier(8)->Range(8, 1 << 16);
+
+static void mutation_value_insertion(benchmark::State& state) {
+    const auto chromosome = make_word(static_cast<std::size_t>(state.range(0)));
+    dp::genetic::value_insertion_mutator<std::string> mutator{
+        dp::genetic::pooled_value_generator<std::string>{alphabet}};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(mutator(chromosome));
+    }
+}
+BENCHMARK(mutation_value_insertion)->RangeMultiplier(8)->Range(8, 4096);
+
+static void mutation_composite(benchmark::State& state) {
+    const auto chromosome = make_word(static_cast<std::size_t>(state.range(0)));
+    dp::genetic::composite_mutator mutator{
+        dp::genetic::no_op_mutator{},
+        dp::genetic::value_replacement<std::string,
+                                       dp::genetic::pooled_value_generator<std::string>>{
+            dp::genetic::pooled_value_generator<std::string>{alphabet}}};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(mutator(chromosome));
+    }
+}
+BENCHMARK(mutation_composite)->RangeMultiplier(8)->Range(8, 4096);
+
+// flips 1 in 100 bits, drawing one random number per flipped bit
+static void mutation_bit_flip(benchmark::State& state) {
+    dp::genetic::bit_chromosome<> chromosome(make_mask(static_cast<std::size_t>(state.range(0))));
+    const dp::genetic::bit_flip_mutator mutator{0.01};
+    for (auto _ : state) {
+        mutator(chromosome);
+        benchmark::DoNotOptimize(chromosome.words().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(mutation_bit_flip)->RangeMultiplier(8)->Range(64, 1 << 15);
+
+// ---- fitness ----
+
+static void fitness_element_wise_comparison(benchmark::State& state) {
+    const auto length = static_cast<std::size_t>(state.range(0));
+    const dp::genetic::element_wise_comparison fitness{make_word(length), 1.0};
+    const auto chromosome = make_word(length);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(fitness(chromosome));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(fitness_element_wise_comparison)->RangeMultiplier(8)->Range(8, 1 << 15);
+
+// std::deque is not contiguous, so it is compared element by element. Compare with the
+// std::string benchmark above to see the speed-up of details::count_equal on long phrases.
+static void fitness_element_wise_comparison_deque(benchmark::State& state) {
+    const auto length = static_cast<std::size_t>(state.range(0));
+    const auto solution = make_word(length);
+    const auto word = make_word(length);
+    const dp::genetic::element_wise_comparison fitness{
+        std::deque<char>(solution.begin(), solution.end()), 1.0};
+    const std::deque<char> chromosome(word.begin(), word.end());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(fitness(chromosome));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(fitness_element_wise_comparison_deque)->RangeMultiplier(8)->Range(8, 1 << 15);
+
+static void fitness_accumulation_int_mask(benchmark::State& state) {
+    const auto chromosome = make_mask(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dp::genetic::accumulation_fitness(chromosome));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(fitness_accumulation_int_mask)->RangeMultiplier(8)->Range(64, 1 << 15);
+
+// counts the set bits with popcount
+static void fitness_accumulation_bits(benchmark::State& state) {
+    const dp::genetic::bit_chromosome<> chromosome(
+        make_mask(static_cast<std::size_t>(state.range(0))));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dp::genetic::accumulation_fitness(chromosome));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(fitness_accumulation_bits)->RangeMultiplier(8)->Range(64, 1 << 15);
+
+static void fitness_accumulation(benchmark::State& state) {
+    const auto chromosome = make_values(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dp::genetic::accumulation_fitness(chromosome));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(fitness_accumulation)->RangeMultiplier(8)->Range(8, 1 << 15);
+
+static void fitness_accumulation_deque(benchmark::State& state) {
+    const auto values = make_values(static_cast<std::size_t>(state.range(0)));
+    const std::deque<double> chromosome(values.begin(), values.end());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dp::genetic::accumulation_fitness(chromosome));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(fitness_accumulation_deque)->RangeMultiplier(8)->Range(8, 1 << 15);
+
+static void fitness_compensated_accumulation(benchmark::State& state) {
+    const auto chromosome = make_values(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dp::genetic::compensated_accumulation_fitness(chromosome));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(fitness_compensated_accumulation)->RangeMultiplier(8)->Range(8, 1 << 15);
+
+static void fitness_composite_sum(benchmark::State& state) {
+    const auto chromosome = make_values(static_cast<std::size_t>(state.range(0)));
+    dp::genetic::composite_sum_fitness fitness{
+        dp::genetic::accumulation_fitness, dp::genetic::accumulation_fitness,
+        [](const std::vector<double>& value) { return static_cast<double>(value.size()); }};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(fitness(chromosome));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(fitness_composite_sum)->RangeMultiplier(8)->Range(8, 4096);
+
+// ---- termination ----
+
+template <typename Termination>
+void termination_check(benchmark::State& state, Termination termination) {
+    const std::string best = "best";
+    double fitness{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(termination(best, fitness));
+        fitness += 1.0;
+    }
+}
+BENCHMARK_CAPTURE(termination_check, generations,
+                  dp::genetic::generations_termination{~std::uint_least64_t{}});
+BENCHMARK_CAPTURE(termination_check, fitness, dp::genetic::fitness_termination{1e300});
+BENCHMARK_CAPTURE(termination_check, fitness_hysteresis,
+                  dp::genetic::fitness_hysteresis{0.5, ~std::uint_least64_t{}});
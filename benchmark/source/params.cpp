@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+#include <genetic/genetic.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace {
+    using chromosome = std::array<double, 4>;
+    constexpr std::uint_least64_t generations = 10;
+
+    // deliberately cheap operators, so the cost of calling them dominates
+    constexpr auto fitness = [](const chromosome& value) {
+        return value[0] + value[1] + value[2] + value[3];
+    };
+    constexpr auto mutator = [](const chromosome& value) {
+        return chromosome{value[1], value[2], value[3], value[0] * 0.5};
+    };
+    constexpr auto crossover = [](const chromosome& first, const chromosome& second) {
+        return chromosome{first[0], first[1], second[2], second[3]};
+    };
+
+    std::vector<chromosome> make_population(std::size_t size) {
+        dp::genetic::uniform_floating_point_generator generator{};
+        std::vector<chromosome> population(size);
+        for (auto& value : population) {
+            for (auto& gene : value) gene = generator(-1.0, 1.0);
+        }
+        return population;
+    }
+
+    template <typename Builder>
+    void solve_with(benchmark::State& state, Builder builder) {
+        const auto initial_population = make_population(static_cast<std::size_t>(state.range(0)));
+        const auto params =
+            builder.with_fitness_operator(fitness)
+                .with_mutation_operator(mutator)
+                .with_crossover_operator(crossover)
+                .template with_selection_operator<decltype(fitness)>(
+                    dp::genetic::tournament_selection{})
+                .with_termination_operator(dp::genetic::generations_termination{generations + 1})
+                .build();
+        // run inline so only the operator calls are measured, not the thread hand-off
+        const dp::genetic::algorithm_settings settings{
+            .crossover_rate = 1.0, .thread_count = 1, .seed = 42};
+
+        for (auto _ : state) {
+            auto result = dp::genetic::solve(initial_population, settings, params);
+            benchmark::DoNotOptimize(result);
+        }
+        state.counters["generation"] = benchmark::Counter(
+            static_cast<double>(generations),
+            benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+    }
+}  // namespace
+
+BENCHMARK_CAPTURE(solve_with, params, dp::genetic::params<chromosome>::builder())
+    ->RangeMultiplier(10)
+    ->Range(1'000, 100'000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(solve_with, static_params, dp::genetic::static_params<chromosome>::builder())
+    ->RangeMultiplier(10)
+    ->Range(1'000, 100'000)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,99 @@
+#include <benchmark/benchmark.h>
+#include <genetic/details/random_helpers.h>
+#include <genetic/fitness.h>
+#include <genetic/population.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+    constexpr std::size_t gene_count = 16;
+    using chromosome = std::array<double, gene_count>;
+    using scored_chromosome = std::pair<chromosome, double>;
+
+    std::vector<chromosome> make_chromosomes(std::size_t size) {
+        dp::genetic::uniform_floating_point_generator generator{};
+        std::vector<chromosome> chromosomes(size);
+        for (auto& value : chromosomes) {
+            for (auto& gene : value) gene = generator(-1.0, 1.0);
+        }
+        return chromosomes;
+    }
+
+    constexpr auto sphere_fitness = [](const auto& genes) {
+        return -std::inner_product(genes.begin(), genes.end(), genes.begin(), 0.0);
+    };
+}  // namespace
+
+// the layout solve() uses: genes and fitness interleaved, sorting moves whole chromosomes
+static void population_pairs_evaluate_and_sort(benchmark::State& state) {
+    const auto chromosomes = make_chromosomes(static_cast<std::size_t>(state.range(0)));
+    std::vector<scored_chromosome> population{};
+    for (const auto& value : chromosomes) population.emplace_back(value, 0.0);
+
+    for (auto _ : state) {
+        for (auto& [genes, fitness] : population) fitness = sphere_fitness(genes);
+        std::ranges::sort(population, std::ranges::greater{}, &scored_chromosome::second);
+        benchmark::DoNotOptimize(population.data());
+        // restore the original order so that every iteration sorts the same data
+        state.PauseTiming();
+        for (std::size_t i = 0; i < chromosomes.size(); ++i) population[i].first = chromosomes[i];
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// structure of arrays: the fitness kernel streams over the gene matrix and only indices are sorted
+static void population_matrix_evaluate_and_order(benchmark::State& state) {
+    dp::genetic::population_matrix<double, gene_count> population(
+        make_chromosomes(static_cast<std::size_t>(state.range(0))));
+
+    for (auto _ : state) {
+        population.evaluate(sphere_fitness);
+        auto order = population.order();
+        benchmark::DoNotOptimize(order.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void population_pairs_elites(benchmark::State& state) {
+    const auto chromosomes = make_chromosomes(static_cast<std::size_t>(state.range(0)));
+    std::vector<scored_chromosome> population{};
+    for (const auto& value : chromosomes) population.emplace_back(value, sphere_fitness(value));
+    const auto elites = population.size() / 10;
+
+    for (auto _ : state) {
+        std::ranges::partial_sort(population,
+                                  population.begin() + static_cast<std::ptrdiff_t>(elites),
+                                  std::ranges::greater{}, &scored_chromosome::second);
+        benchmark::DoNotOptimize(population.data());
+        state.PauseTiming();
+        std::ranges::shuffle(population,
+                             dp::genetic::details::thread_random_engine<std::mt19937>());
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void population_matrix_elites(benchmark::State& state) {
+    dp::genetic::population_matrix<double, gene_count> population(
+        make_chromosomes(static_cast<std::size_t>(state.range(0))));
+    population.evaluate(sphere_fitness);
+    const auto elites = population.size() / 10;
+
+    for (auto _ : state) {
+        auto best = population.best(elites);
+        benchmark::DoNotOptimize(best.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(population_pairs_evaluate_and_sort)->Arg(1'000)->Arg(10'000)->Arg(100'000);
+BENCHMARK(population_matrix_evaluate_and_order)->Arg(1'000)->Arg(10'000)->Arg(100'000);
+BENCHMARK(population_pairs_elites)->Arg(1'000)->Arg(10'000)->Arg(100'000);
+BENCHMARK(population_matrix_elites)->Arg(1'000)->Arg(10'000)->Arg(100'000);
@@ -0,0 +1,52 @@
+#include <benchmark/benchmark.h>
+#include <genetic/op/crossover/random_crossover.h>
+#include <genetic/op/mutation/value_mutation.h>
+
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    template <typename Engine>
+    void raw_engine(benchmark::State& state) {
+        auto& engine = dp::genetic::details::thread_random_engine<Engine>();
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(engine());
+        }
+    }
+
+    template <typename Engine>
+    void value_mutation(benchmark::State& state) {
+        const auto mutator = dp::genetic::double_value_mutator<Engine>(-0.5, 0.5);
+        const std::vector<double> chromosome(static_cast<std::size_t>(state.range(0)), 0.5);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(mutator(chromosome));
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    template <typename Engine>
+    void random_crossover(benchmark::State& state) {
+        dp::genetic::basic_random_crossover<dp::genetic::basic_uniform_integral_generator<Engine>>
+            crossover{};
+        const auto length = static_cast<std::size_t>(state.range(0));
+        const std::string first(length, 'a');
+        const std::string second(length, 'b');
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(crossover(first, second));
+        }
+    }
+}  // namespace
+
+BENCHMARK_TEMPLATE(raw_engine, std::mt19937);
+BENCHMARK_TEMPLATE(raw_engine, dp::genetic::xoshiro256pp);
+BENCHMARK_TEMPLATE(raw_engine, dp::genetic::philox4x32);
+
+BENCHMARK_TEMPLATE(value_mutation, std::mt19937)->Arg(1 << 10);
+BENCHMARK_TEMPLATE(value_mutation, dp::genetic::xoshiro256pp)->Arg(1 << 10);
+BENCHMARK_TEMPLATE(value_mutation, dp::genetic::philox4x32)->Arg(1 << 10);
+
+BENCHMARK_TEMPLATE(random_crossover, std::mt19937)->Arg(64);
+BENCHMARK_TEMPLATE(random_crossover, dp::genetic::xoshiro256pp)->Arg(64);
+BENCHMARK_TEMPLATE(random_crossover, dp::genetic::philox4x32)->Arg(64);
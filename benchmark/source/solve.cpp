@@ -0,0 +1,303 @@
+#include <benchmark/benchmark.h>
+#include <genetic/crossover.h>
+#include <genetic/fitness.h>
+#include <genetic/genetic.h>
+#include <genetic/mutation.h>
+#include <genetic/selection.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+    constexpr std::uint_least64_t seed = 42;
+    constexpr std::uint_least64_t generations = 20;
+
+    /// @brief Settings shared by the end to end benchmarks, seeded so every run does the same work.
+    dp::genetic::algorithm_settings make_settings(const benchmark::State& state) {
+        return {.elitism_rate = 0.1,
+                .mutation_rate = 0.5,
+                .crossover_rate = 0.5,
+                .thread_count = static_cast<std::size_t>(state.range(1)),
+                .seed = seed};
+    }
+
+    void set_counters(benchmark::State& state) {
+        state.counters["generation"] = benchmark::Counter(
+            static_cast<double>(generations),
+            benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+    }
+
+    // ---- knapsack ----
+
+    // knapsack problem as described here: https://en.wikipedia.org/wiki/Knapsack_problem
+    using knapsack = std::array<int, 5>;
+
+    struct knapsack_box {
+        int value;
+        int weight;
+    };
+
+    constexpr auto max_weight = 15;
+    constexpr std::array<knapsack_box, 5> available_items{
+        {{4, 12}, {2, 1}, {10, 4}, {1, 1}, {2, 2}}};
+
+    int knapsack_fitness(const knapsack& ks) {
+        auto value_sum = 0;
+        auto weight_sum = 0;
+        for (const auto& index : ks) {
+            if (index >= 0 && index < static_cast<int>(available_items.size())) {
+                value_sum += available_items[index].value;
+                weight_sum += available_items[index].weight;
+            }
+        }
+        if (weight_sum > max_weight) value_sum -= 25 * std::abs(weight_sum - max_weight);
+        return value_sum;
+    }
+
+    knapsack knapsack_mutator(const knapsack& ks) {
+        auto& engine = dp::genetic::details::thread_random_engine<std::mt19937>();
+        knapsack output = ks;
+        std::uniform_int_distribution<std::size_t> distribution(0, ks.size() - 1);
+        const auto index = distribution(engine);
+
+        if (std::ranges::count(output, -1) > 0) {
+            std::uniform_int_distribution<int> item_dist(0, available_items.size() - 1);
+            auto new_value = item_dist(engine);
+            while (std::ranges::find(output, new_value) != std::end(output)) {
+                new_value = item_dist(engine);
+            }
+            output[index] = new_value;
+        } else {
+            std::ranges::shuffle(output, engine);
+        }
+        return output;
+    }
+
+    knapsack knapsack_crossover(const knapsack& first, const knapsack& second) {
+        knapsack child{};
+        std::ranges::fill(child, -1);
+
+        auto first_copy_end = first.begin() + 3;
+        const auto first_negative = std::ranges::find(first, -1);
+        if (first_negative != first.end() && first_negative < first_copy_end) {
+            first_copy_end = first_negative;
+        }
+        std::ranges::copy(first.begin(), first_copy_end, child.begin());
+
+        auto child_first_negative = std::ranges::find(child, -1);
+        for (const auto& value : second) {
+            if (child_first_negative == child.end()) break;
+            if (std::ranges::find(child, value) == child.end()) {
+                *child_first_negative = value;
+                child_first_negative += 1;
+            }
+        }
+        return child;
+    }
+
+    std::vector<knapsack> make_knapsacks(std::size_t size) {
+        std::mt19937 engine{seed};
+        std::uniform_int_distribution length_dist(1, 4);
+        std::uniform_int_distribution<int> values_dist(0, available_items.size() - 1);
+
+        std::vector<knapsack> population(size);
+        for (auto& value : population) {
+            std::ranges::fill(value, -1);
+            const auto length = length_dist(engine);
+            for (auto i = 0; i < length; ++i) {
+                auto item = values_dist(engine);
+                while (std::ranges::find(value, item) != std::end(value)) {
+                    item = values_dist(engine);
+                }
+                value[i] = item;
+            }
+        }
+        return population;
+    }
+
+    // ---- phrase guess ----
+
+    const std::string alphabet = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ!,. '";
+    const std::string phrase = "Hello, genetic algorithms, how fast can you go?";
+
+    /// @brief The phrase repeated up to the given length, for phrases where scoring dominates.
+    std::string make_phrase(std::size_t length) {
+        std::string output{};
+        output.reserve(length);
+        while (output.size() < length) {
+            output.append(phrase, 0, std::min(phrase.size(), length - output.size()));
+        }
+        return output;
+    }
+
+    template <typename Word>
+    std::vector<Word> make_words(std::size_t size, std::size_t phrase_length = phrase.size()) {
+        std::mt19937 engine{seed};
+        std::uniform_int_distribution<std::size_t> length_dist(1, phrase_length * 3 / 2);
+        std::uniform_int_distribution<std::size_t> char_dist(0, alphabet.size() - 1);
+
+        std::vector<Word> population(size);
+        for (auto& word : population) {
+            word.resize(length_dist(engine));
+            for (auto& value : word) value = alphabet[char_dist(engine)];
+        }
+        return population;
+    }
+
+    /// @brief Scores like element_wise_comparison, but one character at a time, as it did before
+    /// details::count_equal.
+    struct element_by_element_comparison {
+        element_by_element_comparison(std::string solution, double match_score)
+            : solution_(std::move(solution)), match_score_(match_score) {}
+
+        double operator()(const std::string& value) const {
+            double score{};
+            const auto length = std::min(solution_.size(), value.size());
+            for (std::size_t index = 0; index < length; ++index) {
+                if (value.at(index) == solution_.at(index)) score += match_score_;
+            }
+            const auto difference = solution_.size() > value.size()
+                                        ? solution_.size() - value.size()
+                                        : value.size() - solution_.size();
+            return score - static_cast<double>(difference);
+        }
+
+      private:
+        std::string solution_;
+        double match_score_;
+    };
+}  // namespace
+
+static void solve_knapsack(benchmark::State& state) {
+    const auto initial_population = make_knapsacks(static_cast<std::size_t>(state.range(0)));
+    const auto params = dp::genetic::params<knapsack>::builder()
+                            .with_mutation_operator(knapsack_mutator)
+                            .with_crossover_operator(knapsack_crossover)
+                            .with_fitness_operator(knapsack_fitness)
+                            .with_termination_operator(
+                                dp::genetic::generations_termination{generations + 1})
+                            .build();
+    const auto settings = make_settings(state);
+
+    for (auto _ : state) {
+        auto result = dp::genetic::solve(initial_population, settings, params);
+        benchmark::DoNotOptimize(result);
+    }
+    set_counters(state);
+}
+
+// std::pmr::string chromosomes are allocated from the arenas of solve(), a non-zero cache
+// capacity enables the fitness cache. The phrase fitness is cheap, so this measures the overhead
+// of the cache.
+template <typename Word, std::size_t CacheCapacity = 0>
+static void solve_phrase_guess(benchmark::State& state) {
+    const auto initial_population = make_words<Word>(static_cast<std::size_t>(state.range(0)));
+
+    dp::genetic::pooled_value_generator<std::string> value_generator(alphabet);
+    auto mutator = dp::genetic::composite_mutator{
+        [](Word& input) {
+            if (input.empty()) input.push_back(alphabet[0]);
+        },
+        dp::genetic::value_replacement<Word, dp::genetic::pooled_value_generator<std::string>>{
+            value_generator}};
+
+    const auto params =
+        typename dp::genetic::params<Word>::builder()
+            .with_mutation_operator(mutator)
+            .with_crossover_operator(dp::genetic::random_crossover{})
+            .with_fitness_operator(
+                dp::genetic::element_wise_comparison(Word(phrase.begin(), phrase.end()), 1.0))
+            .with_termination_operator(dp::genetic::generations_termination{generations + 1})
+            .build();
+    auto settings = make_settings(state);
+    settings.fitness_cache_capacity = CacheCapacity;
+
+    dp::genetic::cache_statistics lookups{};
+    for (auto _ : state) {
+        auto result = dp::genetic::solve(initial_population, settings, params,
+                                         [&lookups](const auto& stats) {
+                                             lookups.hits += stats.fitness_cache_lookups.hits;
+                                             lookups.misses += stats.fitness_cache_lookups.misses;
+                                         });
+        benchmark::DoNotOptimize(result);
+    }
+    set_counters(state);
+    if constexpr (CacheCapacity > 0) state.counters["hit_rate"] = lookups.hit_rate();
+}
+
+// phrase_guess with long phrases, where scoring the chromosomes dominates. Compare
+// element_wise_comparison (details::count_equal) with the element by element baseline to see
+// the speed-up of the comparison kernel on a whole solve().
+template <typename Fitness>
+static void solve_long_phrase_guess(benchmark::State& state) {
+    const auto target = make_phrase(static_cast<std::size_t>(state.range(0)));
+    const auto initial_population = make_words<std::string>(1'000, target.size());
+
+    dp::genetic::pooled_value_generator<std::string> value_generator(alphabet);
+    auto mutator = dp::genetic::composite_mutator{
+        [](std::string& input) {
+            if (input.empty()) input.push_back(alphabet[0]);
+        },
+        dp::genetic::value_replacement<std::string,
+                                       dp::genetic::pooled_value_generator<std::string>>{
+            value_generator}};
+
+    const auto params =
+        dp::genetic::params<std::string>::builder()
+            .with_mutation_operator(mutator)
+            .with_crossover_operator(dp::genetic::random_crossover{})
+            .with_fitness_operator(Fitness(target, 1.0))
+            .with_termination_operator(dp::genetic::generations_termination{generations + 1})
+            .build();
+    const auto settings = make_settings(state);
+
+    for (auto _ : state) {
+        auto result = dp::genetic::solve(initial_population, settings, params);
+        benchmark::DoNotOptimize(result);
+    }
+    set_counters(state);
+}
+
+// thread count 0 uses the shared worker pool, 1 runs everything on the calling thread
+BENCHMARK(solve_knapsack)
+    ->ArgsProduct({{100, 1'000, 10'000}, {0, 1, 2, 4}})
+    ->ArgNames({"population", "threads"})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(solve_phrase_guess<std::string>)
+    ->ArgsProduct({{100, 1'000, 10'000}, {0, 1, 2, 4}})
+    ->ArgNames({"population", "threads"})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(solve_phrase_guess<std::pmr::string>)
+    ->ArgsProduct({{100, 1'000, 10'000}, {0, 1, 2, 4}})
+    ->ArgNames({"population", "threads"})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(solve_phrase_guess<std::string, 1 << 16>)
+    ->ArgsProduct({{100, 1'000, 10'000}, {0, 1}})
+    ->ArgNames({"population", "threads"})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+// a cache smaller than the population keeps evicting chromosomes
+BENCHMARK(solve_phrase_guess<std::string, 1 << 10>)
+    ->ArgsProduct({{10'000}, {0, 1}})
+    ->ArgNames({"population", "threads"})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(solve_long_phrase_guess<dp::genetic::element_wise_comparison<std::string>>)
+    ->ArgsProduct({{256, 4'096, 32'768}, {1}})
+    ->ArgNames({"phrase", "threads"})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(solve_long_phrase_guess<element_by_element_comparison>)
+    ->ArgsProduct({{256, 4'096, 32'768}, {1}})
+    ->ArgNames({"phrase", "threads"})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
@@ -0,0 +1,319 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "genetic/details/hash.h"
+
+namespace dp::genetic {
+    namespace details {
+        using bit_word = std::uint64_t;
+        inline constexpr std::size_t bits_per_word = std::numeric_limits<bit_word>::digits;
+
+        /// @brief Number of words needed to store bit_count bits.
+        [[nodiscard]] constexpr std::size_t bit_word_count(std::size_t bit_count) noexcept {
+            return (bit_count + bits_per_word - 1) / bits_per_word;
+        }
+
+        /// @brief Word with the low count bits set.
+        [[nodiscard]] constexpr bit_word low_bits_mask(std::size_t count) noexcept {
+            return count >= bits_per_word ? ~bit_word{0} : (bit_word{1} << count) - 1;
+        }
+
+        /// @brief Reads count (at most 64) bits, starting at a bit position, into the low bits of
+        /// a word.
+        [[nodiscard]] constexpr bit_word load_bits(std::span<const bit_word> words,
+                                                   std::size_t position,
+                                                   std::size_t count) noexcept {
+            const auto word = position / bits_per_word;
+            const auto offset = position % bits_per_word;
+            auto bits = words[word] >> offset;
+            if (offset != 0 && offset + count > bits_per_word) {
+                bits |= words[word + 1] << (bits_per_word - offset);
+            }
+            return bits & low_bits_mask(count);
+        }
+
+        /**
+         * @brief Copies count bits from one bit position to another, up to a word at a time.
+         * @details Neither position has to be word aligned. The source and the destination must
+         * not overlap.
+         */
+        constexpr void copy_bits(std::span<const bit_word> source, std::size_t source_position,
+                                 std::span<bit_word> destination,
+                                 std::size_t destination_position, std::size_t count) noexcept {
+            while (count > 0) {
+                const auto offset = destination_position % bits_per_word;
+                const auto chunk = std::min(count, bits_per_word - offset);
+                const auto mask = low_bits_mask(chunk) << offset;
+                auto &word = destination[destination_position / bits_per_word];
+                word = (word & ~mask) | (load_bits(source, source_position, chunk) << offset);
+                source_position += chunk;
+                destination_position += chunk;
+                count -= chunk;
+            }
+        }
+    }  // namespace details
+
+    /**
+     * @brief Chromosome of bits, packed 64 to a word.
+     * @details Binary problems (i.e. inclusion masks or feature selection) only need one bit per
+     * gene instead of the 32 of a std::vector<int>. random_crossover, uniform_crossover and
+     * bit_flip_mutator work on whole words, and fitness operators count bits with popcount (see
+     * count() and count_equal()). The chromosome is also a random access range of bool, so the
+     * generic operators accept it. The unused bits of the last word are always 0.
+     * @tparam Bits The number of bits, std::dynamic_extent if it is only known at runtime.
+     */
+    template <std::size_t Bits = std::dynamic_extent>
+    class bit_chromosome {
+        static constexpr bool dynamic = Bits == std::dynamic_extent;
+
+      public:
+        /// @brief Type definitions
+        /// @{
+        using word_type = details::bit_word;
+        using value_type = bool;
+        using size_type = std::size_t;
+        using storage_type =
+            std::conditional_t<dynamic, std::vector<word_type>,
+                               std::array<word_type, details::bit_word_count(dynamic ? 0 : Bits)>>;
+        /// @}
+
+        /// @brief Read only random access iterator over the bits.
+        class const_iterator {
+          public:
+            using iterator_concept = std::random_access_iterator_tag;
+            // the bits are returned by value, which only makes this an input iterator for the
+            // standard library algorithms
+            using iterator_category = std::input_iterator_tag;
+            using value_type = bool;
+            using difference_type = std::ptrdiff_t;
+            using reference = bool;
+            using pointer = void;
+
+            constexpr const_iterator() noexcept = default;
+            constexpr const_iterator(const bit_chromosome *chromosome, size_type index) noexcept
+                : chromosome_(chromosome), index_(index) {}
+
+            [[nodiscard]] constexpr bool operator*() const noexcept {
+                return chromosome_->test(index_);
+            }
+            [[nodiscard]] constexpr bool operator[](difference_type offset) const noexcept {
+                return *(*this + offset);
+            }
+
+            constexpr const_iterator &operator++() noexcept {
+                ++index_;
+                return *this;
+            }
+            constexpr const_iterator operator++(int) noexcept {
+                auto previous = *this;
+                ++index_;
+                return previous;
+            }
+            constexpr const_iterator &operator--() noexcept {
+                --index_;
+                return *this;
+            }
+            constexpr const_iterator operator--(int) noexcept {
+                auto previous = *this;
+                --index_;
+                return previous;
+            }
+            constexpr const_iterator &operator+=(difference_type offset) noexcept {
+                index_ = static_cast<size_type>(static_cast<difference_type>(index_) + offset);
+                return *this;
+            }
+            constexpr const_iterator &operator-=(difference_type offset) noexcept {
+                return *this += -offset;
+            }
+
+            [[nodiscard]] friend constexpr const_iterator operator+(const_iterator iterator,
+                                                                    difference_type offset) {
+                return iterator += offset;
+            }
+            [[nodiscard]] friend constexpr const_iterator operator+(difference_type offset,
+                                                                    const_iterator iterator) {
+                return iterator += offset;
+            }
+            [[nodiscard]] friend constexpr const_iterator operator-(const_iterator iterator,
+                                                                    difference_type offset) {
+                return iterator -= offset;
+            }
+            [[nodiscard]] friend constexpr difference_type operator-(const const_iterator &first,
+                                                                     const const_iterator &second) {
+                return static_cast<difference_type>(first.index_) -
+                       static_cast<difference_type>(second.index_);
+            }
+            [[nodiscard]] friend constexpr bool operator==(const const_iterator &first,
+                                                           const const_iterator &second) {
+                return first.index_ == second.index_;
+            }
+            [[nodiscard]] friend constexpr auto operator<=>(const const_iterator &first,
+                                                            const const_iterator &second) {
+                return first.index_ <=> second.index_;
+            }
+
+          private:
+            const bit_chromosome *chromosome_{};
+            size_type index_{};
+        };
+
+        constexpr bit_chromosome() = default;
+
+        /// @brief Creates a chromosome of size bits, all set to value.
+        constexpr explicit bit_chromosome(size_type size, bool value = false)
+            requires dynamic
+            : size_(size), words_(details::bit_word_count(size), value ? ~word_type{0} : 0) {
+            clear_unused_bits();
+        }
+
+        /// @brief Creates a chromosome from a range of values, non-zero values are set bits.
+        template <std::ranges::input_range Range>
+            requires std::convertible_to<std::ranges::range_reference_t<Range>, bool> &&
+                     (!std::same_as<std::remove_cvref_t<Range>, bit_chromosome>)
+        constexpr explicit bit_chromosome(const Range &values) {
+            if constexpr (dynamic) resize(static_cast<size_type>(std::ranges::distance(values)));
+            assert(static_cast<size_type>(std::ranges::distance(values)) == size());
+            size_type index{0};
+            for (auto &&value : values) set(index++, static_cast<bool>(value));
+        }
+
+        constexpr bit_chromosome(std::initializer_list<bool> values)
+            : bit_chromosome(std::span<const bool>(values.begin(), values.size())) {}
+
+        [[nodiscard]] constexpr size_type size() const noexcept { return size_; }
+        [[nodiscard]] constexpr bool empty() const noexcept { return size_ == 0; }
+
+        /// @brief Changes the number of bits, new bits are 0.
+        constexpr void resize(size_type size)
+            requires dynamic
+        {
+            size_ = size;
+            words_.resize(details::bit_word_count(size));
+            clear_unused_bits();
+        }
+
+        [[nodiscard]] constexpr bool test(size_type index) const noexcept {
+            assert(index < size_);
+            return (words_[index / details::bits_per_word] >> (index % details::bits_per_word)) &
+                   word_type{1};
+        }
+        [[nodiscard]] constexpr bool operator[](size_type index) const noexcept {
+            return test(index);
+        }
+
+        constexpr void set(size_type index, bool value = true) noexcept {
+            assert(index < size_);
+            const auto mask = word_type{1} << (index % details::bits_per_word);
+            auto &word = words_[index / details::bits_per_word];
+            word = value ? word | mask : word & ~mask;
+        }
+        constexpr void reset(size_type index) noexcept { set(index, false); }
+        constexpr void flip(size_type index) noexcept {
+            assert(index < size_);
+            words_[index / details::bits_per_word] ^= word_type{1}
+                                                      << (index % details::bits_per_word);
+        }
+
+        /// @brief Flips every bit.
+        constexpr void flip() noexcept {
+            for (auto &word : words_) word = ~word;
+            clear_unused_bits();
+        }
+
+        /// @brief Number of set bits.
+        [[nodiscard]] constexpr size_type count() const noexcept {
+            size_type total{0};
+            for (const auto word : words_) total += static_cast<size_type>(std::popcount(word));
+            return total;
+        }
+
+        /// @brief Number of positions, up to the smaller size, at which both chromosomes have
+        /// the same bit.
+        [[nodiscard]] constexpr size_type count_equal(const bit_chromosome &other) const noexcept {
+            const auto shared_size = std::min(size_, other.size_);
+            const auto full_words = shared_size / details::bits_per_word;
+            size_type total{0};
+            for (size_type word = 0; word < full_words; ++word) {
+                const auto equal = ~(words_[word] ^ other.words_[word]);
+                total += static_cast<size_type>(std::popcount(equal));
+            }
+            if (const auto remaining = shared_size % details::bits_per_word; remaining != 0) {
+                const auto equal = ~(words_[full_words] ^ other.words_[full_words]);
+                total += static_cast<size_type>(
+                    std::popcount(equal & details::low_bits_mask(remaining)));
+            }
+            return total;
+        }
+
+        /// @brief Calls function with the index of every set bit, in increasing order.
+        template <std::invocable<size_type> Function>
+        constexpr void for_each_set_bit(Function &&function) const {
+            for (size_type word = 0; word < words_.size(); ++word) {
+                for (auto bits = words_[word]; bits != 0; bits &= bits - 1) {
+                    std::invoke(function, word * details::bits_per_word +
+                                              static_cast<size_type>(std::countr_zero(bits)));
+                }
+            }
+        }
+
+        /// @brief The packed bits, bit i is bit i % 64 of word i / 64. The unused bits of the
+        /// last word must stay 0.
+        [[nodiscard]] constexpr std::span<word_type> words() noexcept { return words_; }
+        [[nodiscard]] constexpr std::span<const word_type> words() const noexcept {
+            return words_;
+        }
+
+        [[nodiscard]] constexpr const_iterator begin() const noexcept { return {this, 0}; }
+        [[nodiscard]] constexpr const_iterator end() const noexcept { return {this, size_}; }
+
+        [[nodiscard]] friend constexpr bool operator==(const bit_chromosome &,
+                                                       const bit_chromosome &) = default;
+
+      private:
+        constexpr void clear_unused_bits() noexcept {
+            if (const auto used = size_ % details::bits_per_word; used != 0) {
+                words_.back() &= details::low_bits_mask(used);
+            }
+        }
+
+        size_type size_{dynamic ? 0 : Bits};
+        storage_type words_{};
+    };
+
+    namespace type_traits {
+        template <typename T>
+        constexpr inline bool is_bit_chromosome = false;
+
+        template <std::size_t Bits>
+        constexpr inline bool is_bit_chromosome<bit_chromosome<Bits>> = true;
+    }  // namespace type_traits
+}  // namespace dp::genetic
+
+/// @brief Hashes the packed words, so fitness_cache works on bit chromosomes.
+template <std::size_t Bits>
+struct std::hash<dp::genetic::bit_chromosome<Bits>> {
+    [[nodiscard]] std::size_t operator()(
+        const dp::genetic::bit_chromosome<Bits> &chromosome) const noexcept {
+        std::size_t seed = chromosome.size();
+        for (const auto word : chromosome.words()) {
+            seed = dp::genetic::details::hash_combine(
+                seed, std::hash<dp::genetic::details::bit_word>{}(word));
+        }
+        return seed;
+    }
+};
@@ -7,21 +7,58 @@
 #include "genetic/details/concepts.h"
 #include "genetic/details/crossover_helpers.h"
 #include "genetic/details/random_helpers.h"
+#include "genetic/op/crossover/blend_crossover.h"
+#include "genetic/op/crossover/k_point_crossover.h"
 #include "genetic/op/crossover/random_crossover.h"
+#include "genetic/op/crossover/simulated_binary_crossover.h"
+#include "genetic/op/crossover/uniform_crossover.h"
 
 namespace dp::genetic {
     namespace details {
         struct make_children_fn {
-            template <std::ranges::range T, concepts::crossover_operator<T> CrossoverOp,
+            template <std::ranges::range T, concepts::any_crossover_operator<T> CrossoverOp,
                       typename SimpleType = std::remove_cvref_t<T>,
                       typename IndexProvider = genetic::uniform_integral_generator>
                 requires(std::is_default_constructible_v<SimpleType> ||
                          std::is_trivially_default_constructible_v<SimpleType>)
             constexpr auto operator()(CrossoverOp &&crossover_op, const T &first, const T &second) {
-                return std::invoke(std::forward<CrossoverOp>(crossover_op), first, second);
+                if constexpr (concepts::crossover_operator<CrossoverOp, T>) {
+                    return std::invoke(std::forward<CrossoverOp>(crossover_op), first, second);
+                } else {
+                    SimpleType child{};
+                    std::invoke(std::forward<CrossoverOp>(crossover_op), first, second, child);
+                    return child;
+                }
             }
         };
 
+        struct make_children_into_fn {
+            template <std::ranges::range T, concepts::any_crossover_operator<T> CrossoverOp>
+            constexpr void operator()(CrossoverOp &&crossover_op, const T &first, const T &second,
+                                      T &child) {
+                if constexpr (concepts::crossover_into_operator<CrossoverOp, T>) {
+                    std::invoke(std::forward<CrossoverOp>(crossover_op), first, second, child);
+                } else {
+                    child = std::invoke(std::forward<CrossoverOp>(crossover_op), first, second);
+                }
+            }
+        };
+
+        struct make_children_pair_into_fn {
+            template <std::ranges::range T, typename CrossoverOp>
+                requires concepts::crossover_pair_operator<CrossoverOp, T> ||
+                         concepts::any_crossover_operator<CrossoverOp, T>
+            constexpr void operator()(CrossoverOp &&crossover_op, const T &first, const T &second,
+                                      T &first_child, T &second_child) {
+                if constexpr (concepts::crossover_pair_operator<CrossoverOp, T>) {
+                    std::invoke(std::forward<CrossoverOp>(crossover_op), first, second,
+                                first_child, second_child);
+                } else {
+                    make_children_into_fn{}(crossover_op, first, second, first_child);
+                    make_children_into_fn{}(crossover_op, second, first, second_child);
+                }
+            }
+        };
     }  // namespace details
 
     /**
@@ -30,4 +67,20 @@ namespace dp::genetic {
      */
     inline auto make_children = details::make_children_fn{};
 
+    /**
+     * @brief A helper function to write a child into an existing chromosome.
+     * @details Crossover operators that support it write the child directly into the
+     * chromosome, reusing its storage. For other operators the new child is moved into it. The
+     * child must not be one of the parents.
+     */
+    inline auto make_children_into = details::make_children_into_fn{};
+
+    /**
+     * @brief A helper function to write both children of two parents into existing chromosomes.
+     * @details Pair crossover operators (see concepts::crossover_pair_operator) make both
+     * children in one pass. Other operators are called twice, the second time with the parents
+     * swapped. The children must not be one of the parents.
+     */
+    inline auto make_children_pair_into = details::make_children_pair_into_fn{};
+
 }  // namespace dp::genetic
@@ -1,6 +1,9 @@
 #pragma once
 #include <concepts>
+#include <functional>
+#include <future>
 #include <ranges>
+#include <span>
 #include <type_traits>
 #include <utility>
 
@@ -44,6 +47,14 @@ namespace dp::genetic {
             { t.empty() } -> std::convertible_to<bool>;
         };
 
+        template <typename T, typename SimpleType = std::remove_cvref_t<T>>
+        concept has_clear = requires(SimpleType &t) { t.clear(); };
+
+        template <typename T, typename SimpleType = std::remove_cvref_t<T>,
+                  typename SizeType = typename SimpleType::size_type>
+        concept has_resize = has_size_type<SimpleType> && std::integral<SizeType> &&
+                             requires(SimpleType &t, SizeType value) { t.resize(value); };
+
         template <typename T>
         concept number = std::integral<T> || std::floating_point<T>;
 
@@ -60,32 +71,118 @@ namespace dp::genetic {
 
     namespace concepts {
         /// @brief Custom concepts needed for genetic algorithm class
+        /// @details Chromosomes are passed to the fitness, crossover and termination operators
+        /// by const reference. Mutation operators are given a chromosome that they may take
+        /// ownership of (i.e. by value or rvalue reference) and return the mutated chromosome.
         /// @{
         template <class Fn, class T>
         concept mutation_operator =
             std::invocable<Fn, T> && std::is_same_v<std::invoke_result_t<Fn, T>, T>;
 
+        /**
+         * @brief Mutation operator that modifies a chromosome in place, i.e. `void(T&)`.
+         * @details Preferred by mutate_in_place() and solve() because the chromosome is never
+         * copied.
+         */
         template <class Fn, class T>
-        concept fitness_operator = std::invocable<Fn, T> && requires(Fn fn) {
-            { fn(std::declval<T>()) } -> type_traits::number;
-        };
+        concept in_place_mutation_operator =
+            std::invocable<Fn, T &> && std::is_void_v<std::invoke_result_t<Fn, T &>>;
+
+        /// @brief Either kind of mutation operator.
+        template <class Fn, class T>
+        concept any_mutation_operator =
+            mutation_operator<Fn, T> || in_place_mutation_operator<Fn, T>;
+
+        template <class Fn, class T, class SimpleType = std::remove_cvref_t<T>>
+        concept fitness_operator =
+            std::invocable<Fn, const SimpleType &> && requires(Fn fn, const SimpleType &value) {
+                { fn(value) } -> type_traits::number;
+            };
+
+        /**
+         * @brief Fitness operator that scores a batch of chromosomes in one call, i.e.
+         * `void(std::span<const T>, std::span<double>)`.
+         * @details The second span has one element per chromosome and receives their fitness.
+         * Used by solve() for fitness functions that are cheaper per chromosome when they score
+         * many at once (i.e. SIMD across chromosomes, shared setup or a call into another
+         * process).
+         */
+        template <class Fn, class T, class SimpleType = std::remove_cvref_t<T>>
+        concept batch_fitness_operator =
+            std::invocable<Fn &, std::span<const SimpleType>, std::span<double>>;
+
+        /// @brief Either kind of fitness operator.
+        template <class Fn, class T>
+        concept any_fitness_operator = fitness_operator<Fn, T> || batch_fitness_operator<Fn, T>;
 
-        template <class Fn, class T, class SimpleType = std::remove_cvref_t<T>,
-                  class Result = std::invoke_result_t<Fn, T, T>>
+        template <class Fn, class T, class SimpleType = std::remove_cvref_t<T>>
         concept crossover_operator =
-            std::invocable<Fn, T, T> && std::is_convertible_v<Result, SimpleType>;
+            std::invocable<Fn, const SimpleType &, const SimpleType &> &&
+            std::is_convertible_v<std::invoke_result_t<Fn, const SimpleType &, const SimpleType &>,
+                                  SimpleType>;
+
+        /**
+         * @brief Crossover operator that writes the child into an existing chromosome, i.e.
+         * `void(const T&, const T&, T&)`.
+         * @details Preferred by solve() because the child can reuse the storage of the
+         * chromosome it replaces.
+         */
+        template <class Fn, class T, class SimpleType = std::remove_cvref_t<T>>
+        concept crossover_into_operator =
+            std::invocable<Fn, const SimpleType &, const SimpleType &, SimpleType &> &&
+            std::is_void_v<
+                std::invoke_result_t<Fn, const SimpleType &, const SimpleType &, SimpleType &>>;
+
+        /**
+         * @brief Crossover operator that writes both children of two parents into existing
+         * chromosomes in one pass, i.e. `void(const T&, const T&, T&, T&)`.
+         * @details The second child is the child of the parents in the opposite order. solve()
+         * uses it instead of two calls of the crossover operator when both children are needed.
+         */
+        template <class Fn, class T, class SimpleType = std::remove_cvref_t<T>>
+        concept crossover_pair_operator =
+            std::invocable<Fn, const SimpleType &, const SimpleType &, SimpleType &,
+                           SimpleType &> &&
+            std::is_void_v<std::invoke_result_t<Fn, const SimpleType &, const SimpleType &,
+                                                SimpleType &, SimpleType &>>;
+
+        /// @brief Either kind of crossover operator.
+        template <class Fn, class T>
+        concept any_crossover_operator =
+            crossover_operator<Fn, T> || crossover_into_operator<Fn, T>;
+
+        /// @brief Chromosome of floating point genes that can be written in place, i.e. for
+        /// blend_crossover and simulated_binary_crossover.
+        template <typename T>
+        concept real_valued_chromosome =
+            std::ranges::random_access_range<T> && std::ranges::sized_range<T> &&
+            std::floating_point<std::ranges::range_value_t<T>> &&
+            std::indirectly_writable<std::ranges::iterator_t<T>, std::ranges::range_value_t<T>>;
 
-        template <class Fn, class T, class Numeric,
-                  class Result = std::invoke_result_t<Fn, T, Numeric>>
+        template <class Fn, class T, class Numeric, class SimpleType = std::remove_cvref_t<T>,
+                  class Result = std::invoke_result_t<Fn, const SimpleType &, Numeric>>
         concept termination_operator =
-            std::invocable<Fn, T, Numeric> && dp::genetic::type_traits::number<Numeric> &&
-            std::convertible_to<Result, bool>;
+            std::invocable<Fn, const SimpleType &, Numeric> &&
+            dp::genetic::type_traits::number<Numeric> && std::convertible_to<Result, bool>;
 
         template <class Fn, class T, class Container, class UnaryOp>
         concept selection_operator =
             std::invocable<Fn, Container, UnaryOp> &&
             std::is_same_v<std::invoke_result_t<Fn, Container, UnaryOp>, std::pair<T, T>>;
 
+        /**
+         * @brief Selection operator that can do its expensive work once per generation.
+         * @details `fn.prepare(population, fitness_op)` returns a sampler that can be called
+         * repeatedly (and concurrently) to draw the indices of two parents from the population.
+         */
+        template <class Fn, class Container, class UnaryOp>
+        concept prepared_selection_operator =
+            requires(Fn fn, Container population, UnaryOp fitness_op) {
+                {
+                    std::invoke(fn.prepare(population, fitness_op))
+                } -> std::convertible_to<std::pair<std::size_t, std::size_t>>;
+            };
+
         template <typename T, typename Index = std::size_t>
         concept index_generator =
             std::integral<std::remove_cvref_t<Index>> && requires(T &&t, Index &&l, Index &&u) {
@@ -96,6 +193,25 @@ namespace dp::genetic {
         concept value_generator =
             std::invocable<Fn> && std::convertible_to<std::invoke_result_t<Fn>, ValueType>;
 
+        /**
+         * @brief Executor that runs the offspring generation tasks of the algorithm.
+         * @details Satisfied by dp::thread_pool and dp::genetic::inline_executor.
+         */
+        template <typename T>
+        concept executor = requires(T &t) {
+            { t.size() } -> std::convertible_to<std::size_t>;
+            { t.enqueue([] {}) } -> std::same_as<std::future<void>>;
+        };
+
+        /**
+         * @brief Executor whose tasks can return a value of type ResultType.
+         * @details Satisfied by dp::thread_pool and dp::genetic::inline_executor.
+         */
+        template <typename T, typename ResultType>
+        concept value_executor = executor<T> && requires(T &t) {
+            { t.enqueue(std::function<ResultType()>{}) } -> std::same_as<std::future<ResultType>>;
+        };
+
         template <typename Range, typename Chromosome,
                   typename T = type_traits::element_type_t<Range>>
         concept population = std::ranges::range<Range> && std::is_same_v<Chromosome, T>;
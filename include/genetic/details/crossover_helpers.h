@@ -1,8 +1,14 @@
 #pragma once
 
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
 #include <ranges>
 #include <type_traits>
 
+#include "genetic/details/concepts.h"
+
 namespace dp::genetic {
     namespace details {
         /**
@@ -63,5 +69,32 @@ namespace dp::genetic {
                    std::output_iterator<T> auto child_output) {
             details::cross(first, second, pivot, pivot, child_output);
         }
+
+        /**
+         * @brief Gives a child the given number of genes, reusing its storage.
+         * @details Resizable children keep their capacity, so a child that replaces a
+         * chromosome of the same size does not allocate. Children of a fixed size (i.e.
+         * std::array) must already have the size.
+         */
+        template <std::ranges::sized_range T>
+        void resize_child(T &child, std::size_t size) {
+            if constexpr (dp::genetic::type_traits::has_resize<T>) {
+                child.resize(static_cast<typename T::size_type>(size));
+            } else {
+                assert(static_cast<std::size_t>(std::ranges::size(child)) == size);
+            }
+        }
+
+        /**
+         * @brief Copies the genes of a parent from offset onwards into the same positions of a
+         * child, i.e. the genes that a shorter second parent does not have.
+         */
+        template <std::ranges::random_access_range T>
+        void copy_tail(const T &parent, T &child, std::size_t offset) {
+            const auto offset_difference = static_cast<std::ranges::range_difference_t<T>>(offset);
+            std::ranges::copy(std::ranges::begin(parent) + offset_difference,
+                              std::ranges::end(parent),
+                              std::ranges::begin(child) + offset_difference);
+        }
     }  // namespace details
 }  // namespace dp::genetic
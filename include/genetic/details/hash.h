@@ -0,0 +1,18 @@
+#pragma once
+#include <cstddef>
+#include <limits>
+
+namespace dp::genetic::details {
+    /// @brief 2^digits / phi for the width of std::size_t, as used by Fibonacci hashing and boost's
+    /// hash_combine.
+    inline constexpr std::size_t golden_ratio =
+        std::numeric_limits<std::size_t>::digits >= 64
+            ? static_cast<std::size_t>(0x9e3779b97f4a7c15ULL)
+            : static_cast<std::size_t>(0x9e3779b9UL);
+
+    /// @brief Mixes a value hash into seed (the boost hash_combine scheme).
+    [[nodiscard]] constexpr std::size_t hash_combine(std::size_t seed,
+                                                     std::size_t value_hash) noexcept {
+        return seed ^ (value_hash + golden_ratio + (seed << 6) + (seed >> 2));
+    }
+}  // namespace dp::genetic::details
@@ -0,0 +1,88 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+namespace dp::genetic {
+    namespace type_traits {
+        /// @brief Contiguous ranges of arithmetic values (i.e. std::string or std::vector<double>)
+        /// that the kernels in details can process without going through iterators.
+        template <typename T>
+        concept contiguous_arithmetic_range =
+            std::ranges::contiguous_range<T> && std::ranges::sized_range<T> &&
+            std::is_arithmetic_v<std::ranges::range_value_t<T>>;
+    }  // namespace type_traits
+
+    namespace details {
+        /**
+         * @brief Counts the positions at which two spans of the same size hold equal values.
+         * @details One byte values (i.e. characters) are compared 8 at a time in a 64 bit word:
+         * the xor of two words has a zero byte for every match, which are counted with a
+         * popcount. Wider values are counted without a branch per element, so the compiler can
+         * vectorise the loop.
+         */
+        template <typename T>
+            requires std::is_arithmetic_v<T>
+        [[nodiscard]] constexpr std::size_t count_equal(std::span<const T> first,
+                                                        std::span<const T> second) {
+            const auto size = std::min(first.size(), second.size());
+            std::size_t matches{0};
+            std::size_t index{0};
+            if constexpr (sizeof(T) == 1) {
+                if (!std::is_constant_evaluated()) {
+                    constexpr std::uint64_t low_bits = 0x7f7f7f7f7f7f7f7fULL;
+                    constexpr auto word_size = sizeof(std::uint64_t);
+                    for (; index + word_size <= size; index += word_size) {
+                        std::uint64_t first_word{};
+                        std::uint64_t second_word{};
+                        std::memcpy(&first_word, first.data() + index, word_size);
+                        std::memcpy(&second_word, second.data() + index, word_size);
+                        const auto difference = first_word ^ second_word;
+                        // the high bit of every byte is set if the byte is not zero
+                        const auto non_zero =
+                            ((difference & low_bits) + low_bits) | difference;
+                        matches += word_size -
+                                   static_cast<std::size_t>(std::popcount(non_zero & ~low_bits));
+                    }
+                }
+            }
+            for (; index < size; ++index) {
+                matches += static_cast<std::size_t>(first[index] == second[index]);
+            }
+            return matches;
+        }
+
+        /**
+         * @brief Sums a span of arithmetic values.
+         * @details Uses independent partial sums, so additions do not wait on each other and the
+         * compiler can vectorise the loop. The result can differ from a sequential sum in the
+         * last bits for floating point values.
+         */
+        template <typename ScoreType, typename T>
+            requires std::is_arithmetic_v<ScoreType> && std::is_arithmetic_v<T>
+        [[nodiscard]] constexpr ScoreType sum(std::span<const T> values) {
+            constexpr std::size_t lanes = 8;
+            std::size_t index{0};
+            ScoreType result{};
+            // combining the partial sums costs more than it saves for short spans
+            if (values.size() >= 4 * lanes) {
+                std::array<ScoreType, lanes> partial_sums{};
+                for (; index + lanes <= values.size(); index += lanes) {
+                    for (std::size_t lane = 0; lane < lanes; ++lane) {
+                        partial_sums[lane] += static_cast<ScoreType>(values[index + lane]);
+                    }
+                }
+                for (const auto partial_sum : partial_sums) result += partial_sum;
+            }
+            for (; index < values.size(); ++index) result += static_cast<ScoreType>(values[index]);
+            return result;
+        }
+    }  // namespace details
+}  // namespace dp::genetic
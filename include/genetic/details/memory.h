@@ -0,0 +1,243 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace dp::genetic {
+    namespace type_traits {
+        template <typename T, typename SimpleType = std::remove_cvref_t<T>>
+        concept has_allocator = requires(const SimpleType &t) {
+            typename SimpleType::allocator_type;
+            { t.get_allocator() } -> std::convertible_to<typename SimpleType::allocator_type>;
+        };
+
+        /// @brief Types that allocate from a std::pmr::memory_resource (i.e. std::pmr::string).
+        template <typename T, typename SimpleType = std::remove_cvref_t<T>>
+        concept uses_memory_resource =
+            has_allocator<SimpleType> &&
+            std::same_as<typename SimpleType::allocator_type,
+                         std::pmr::polymorphic_allocator<typename SimpleType::value_type>>;
+    }  // namespace type_traits
+
+    namespace details {
+        template <typename T>
+        concept allocator_extended_copyable =
+            type_traits::has_allocator<T> &&
+            std::constructible_from<T, const T &, typename T::allocator_type>;
+
+        template <typename T>
+        concept allocator_constructible =
+            type_traits::has_allocator<T> && std::constructible_from<T, typename T::allocator_type>;
+
+        /**
+         * @brief Copies a value using the allocator of the value.
+         * @details Allocator aware containers normally pick a new allocator for a copy, which
+         * means std::pmr containers fall back to the default memory resource.
+         */
+        template <typename T>
+        [[nodiscard]] constexpr T copy_of(const T &value) {
+            if constexpr (allocator_extended_copyable<T>) {
+                return T(value, value.get_allocator());
+            } else {
+                return value;
+            }
+        }
+
+        /// @brief Creates an empty value that uses the same allocator as the given value.
+        template <typename T>
+        [[nodiscard]] constexpr T empty_like(const T &value) {
+            if constexpr (allocator_constructible<T>) {
+                return T(value.get_allocator());
+            } else {
+                return T{};
+            }
+        }
+
+        /**
+         * @brief Allocator that aligns every allocation to the given alignment.
+         * @details Used for storage that is streamed over by vectorized loops, a 64 byte
+         * alignment also keeps the start of the storage on a cache line.
+         */
+        template <typename T, std::size_t Alignment = 64>
+        struct aligned_allocator {
+            static_assert(Alignment >= alignof(T) && std::has_single_bit(Alignment));
+            using value_type = T;
+
+            template <typename U>
+            struct rebind {
+                using other = aligned_allocator<U, Alignment>;
+            };
+
+            aligned_allocator() = default;
+            template <typename U>
+            constexpr aligned_allocator(const aligned_allocator<U, Alignment> &) noexcept {}
+
+            [[nodiscard]] T *allocate(std::size_t count) {
+                return static_cast<T *>(
+                    ::operator new(count * sizeof(T), std::align_val_t{Alignment}));
+            }
+
+            void deallocate(T *pointer, std::size_t count) noexcept {
+                ::operator delete(pointer, count * sizeof(T), std::align_val_t{Alignment});
+            }
+
+            template <typename U>
+            friend constexpr bool operator==(const aligned_allocator &,
+                                             const aligned_allocator<U, Alignment> &) noexcept {
+                return true;
+            }
+        };
+
+        /**
+         * @brief Single threaded bump allocator that keeps its memory when it is reset.
+         * @details Memory is carved from large blocks and only returned all at once by reset().
+         * When more than one block was needed, reset() replaces them with a single block that
+         * is large enough for all of them, so repeating the same allocations never goes back to
+         * the heap.
+         */
+        class bump_arena {
+          public:
+            [[nodiscard]] void *allocate(std::size_t bytes, std::size_t alignment) {
+                void *pointer = blocks_.empty() ? nullptr : allocate_from_block(bytes, alignment);
+                if (pointer == nullptr) {
+                    add_block(bytes + alignment);
+                    pointer = allocate_from_block(bytes, alignment);
+                }
+                return pointer;
+            }
+
+            /// @brief Makes all the memory available again, none of it may still be in use.
+            void reset() {
+                if (blocks_.size() > 1) {
+                    std::size_t total_size{};
+                    for (const auto &block : blocks_) total_size += block.size;
+                    blocks_.clear();
+                    add_block(total_size);
+                }
+                used_ = 0;
+            }
+
+            /// @brief Number of bytes that the arena got from the heap.
+            [[nodiscard]] std::size_t capacity() const {
+                std::size_t total_size{};
+                for (const auto &block : blocks_) total_size += block.size;
+                return total_size;
+            }
+
+          private:
+            static constexpr std::size_t minimum_block_size = 4096;
+
+            struct block {
+                std::unique_ptr<std::byte[]> data;
+                std::size_t size{};
+            };
+
+            void *allocate_from_block(std::size_t bytes, std::size_t alignment) {
+                auto &current = blocks_.back();
+                void *pointer = current.data.get() + used_;
+                auto space = current.size - used_;
+                if (std::align(alignment, bytes, pointer, space) == nullptr) return nullptr;
+                used_ = current.size - space + bytes;
+                return pointer;
+            }
+
+            void add_block(std::size_t minimum_size) {
+                // grow geometrically so that a growing generation needs few blocks
+                const auto size = std::max({minimum_size, minimum_block_size,
+                                            blocks_.empty() ? 0 : 2 * blocks_.back().size});
+                blocks_.push_back({std::make_unique_for_overwrite<std::byte[]>(size), size});
+                used_ = 0;
+            }
+
+            std::vector<block> blocks_{};
+            std::size_t used_{};
+        };
+    }  // namespace details
+
+    /**
+     * @brief Memory resource for the chromosomes of one population.
+     * @details Every thread that allocates from the resource gets its own bump arena, so worker
+     * threads never contend on the heap while they create children. Deallocation does nothing,
+     * all the memory is reclaimed at once by reset() which keeps it for the next generation.
+     * Because there is a single resource, all the chromosomes of a population have equal
+     * allocators and can be swapped (i.e. sorted) regardless of the thread that created them.
+     */
+    class generation_arena : public std::pmr::memory_resource {
+      public:
+        generation_arena() = default;
+        generation_arena(const generation_arena &) = delete;
+        generation_arena &operator=(const generation_arena &) = delete;
+
+        /**
+         * @brief Makes all the memory of the arena available again.
+         * @details Nothing allocated from the arena may be used after this, and no thread may
+         * allocate from it while it is reset.
+         */
+        void reset() {
+            std::scoped_lock lock(mutex_);
+            for (auto &[thread, arena] : arenas_) arena->reset();
+        }
+
+        /// @brief Number of bytes that the arena got from the heap.
+        [[nodiscard]] std::size_t capacity() const {
+            std::scoped_lock lock(mutex_);
+            std::size_t total_size{};
+            for (const auto &[thread, arena] : arenas_) total_size += arena->capacity();
+            return total_size;
+        }
+
+      private:
+        void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+            return thread_arena().allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void *, std::size_t, std::size_t) override {}
+
+        [[nodiscard]] bool do_is_equal(
+            const std::pmr::memory_resource &other) const noexcept override {
+            return this == &other;
+        }
+
+        details::bump_arena &thread_arena() {
+            // threads usually allocate from the same resource many times in a row, so the last
+            // one is cached. Every resource has a unique id, addresses can be reused.
+            struct cache_entry {
+                std::uint_least64_t id{};
+                details::bump_arena *arena{};
+            };
+            thread_local cache_entry cache{};
+            if (cache.id == id_) return *cache.arena;
+
+            std::scoped_lock lock(mutex_);
+            const auto thread = std::this_thread::get_id();
+            auto location = std::ranges::find(arenas_, thread, &arena_entry::first);
+            if (location == arenas_.end()) {
+                arenas_.emplace_back(thread, std::make_unique<details::bump_arena>());
+                location = std::prev(arenas_.end());
+            }
+            cache = {id_, location->second.get()};
+            return *cache.arena;
+        }
+
+        static std::uint_least64_t next_id() {
+            static std::atomic<std::uint_least64_t> id{0};
+            return ++id;
+        }
+
+        using arena_entry = std::pair<std::thread::id, std::unique_ptr<details::bump_arena>>;
+
+        const std::uint_least64_t id_{next_id()};
+        mutable std::mutex mutex_;
+        std::vector<arena_entry> arenas_{};
+    };
+}  // namespace dp::genetic
@@ -0,0 +1,182 @@
+#pragma once
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <random>
+
+namespace dp::genetic {
+    namespace details {
+        /// @brief SplitMix64 step, used to expand a single seed into a full engine state.
+        constexpr std::uint64_t splitmix64(std::uint64_t &state) noexcept {
+            auto z = (state += 0x9E3779B97F4A7C15ull);
+            z = (z ^ (z >> 30u)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27u)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31u);
+        }
+
+        /// @brief Types that can seed a random engine (i.e. std::seed_seq).
+        template <typename T>
+        concept seed_sequence = requires(T &seq, std::uint32_t *output) {
+            seq.generate(output, output);
+        };
+    }  // namespace details
+
+    /**
+     * @brief xoshiro256++ pseudo random number generator.
+     * @details 256 bits of state and a handful of instructions per number, which makes it much
+     * cheaper to seed and to run than std::mt19937. See https://prng.di.unimi.it/.
+     */
+    class xoshiro256pp {
+      public:
+        using result_type = std::uint64_t;
+        static constexpr result_type default_seed = 0x853C49E6748FEA9Bull;
+
+        constexpr xoshiro256pp() noexcept : xoshiro256pp(default_seed) {}
+
+        constexpr explicit xoshiro256pp(result_type seed) noexcept {
+            for (auto &word : state_) word = details::splitmix64(seed);
+        }
+
+        template <details::seed_sequence SeedSequence>
+        explicit xoshiro256pp(SeedSequence &seeds) {
+            std::array<std::uint32_t, 8> data{};
+            seeds.generate(data.begin(), data.end());
+            for (std::size_t i = 0; i < state_.size(); ++i) {
+                state_[i] = (static_cast<std::uint64_t>(data[2 * i + 1]) << 32u) | data[2 * i];
+            }
+            // the all zero state is the only invalid state
+            if (state_ == decltype(state_){}) *this = xoshiro256pp{};
+        }
+
+        [[nodiscard]] static constexpr result_type min() noexcept { return 0; }
+        [[nodiscard]] static constexpr result_type max() noexcept {
+            return std::numeric_limits<result_type>::max();
+        }
+
+        constexpr result_type operator()() noexcept {
+            const auto result = std::rotl(state_[0] + state_[3], 23) + state_[0];
+            const auto t = state_[1] << 17u;
+            state_[2] ^= state_[0];
+            state_[3] ^= state_[1];
+            state_[1] ^= state_[2];
+            state_[0] ^= state_[3];
+            state_[2] ^= t;
+            state_[3] = std::rotl(state_[3], 45);
+            return result;
+        }
+
+        constexpr void discard(unsigned long long count) noexcept {
+            for (; count > 0; --count) (*this)();
+        }
+
+        /**
+         * @brief Advances the state by 2^128 steps.
+         * @details Calling jump() n times on copies of the same engine gives n non-overlapping
+         * streams.
+         */
+        constexpr void jump() noexcept {
+            constexpr std::array<std::uint64_t, 4> jump_table{
+                0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull, 0xA9582618E03FC9AAull,
+                0x39ABDC4529B1661Cull};
+            std::array<std::uint64_t, 4> jumped{};
+            for (const auto word : jump_table) {
+                for (unsigned bit = 0; bit < 64; ++bit) {
+                    if (word & (std::uint64_t{1} << bit)) {
+                        for (std::size_t i = 0; i < jumped.size(); ++i) jumped[i] ^= state_[i];
+                    }
+                    (*this)();
+                }
+            }
+            state_ = jumped;
+        }
+
+        friend constexpr bool operator==(const xoshiro256pp &, const xoshiro256pp &) = default;
+
+      private:
+        std::array<std::uint64_t, 4> state_{};
+    };
+
+    /**
+     * @brief Philox4x32-10 counter-based random number generator.
+     * @details Every output block is a pure function of a 64 bit key and a 128 bit counter, so
+     * independent streams only need different keys (or counter ranges) and the state is tiny.
+     * See Salmon et al., "Parallel random numbers: as easy as 1, 2, 3".
+     */
+    class philox4x32 {
+      public:
+        using result_type = std::uint32_t;
+        using counter_type = std::array<std::uint32_t, 4>;
+        using key_type = std::array<std::uint32_t, 2>;
+        static constexpr std::uint64_t default_seed = 20111115u;
+
+        constexpr philox4x32() noexcept : philox4x32(default_seed) {}
+
+        constexpr explicit philox4x32(std::uint64_t seed, std::uint64_t stream = 0) noexcept
+            : key_{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32u)},
+              counter_{0, 0, static_cast<std::uint32_t>(stream),
+                       static_cast<std::uint32_t>(stream >> 32u)} {}
+
+        template <details::seed_sequence SeedSequence>
+        explicit philox4x32(SeedSequence &seeds) {
+            std::array<std::uint32_t, 4> data{};
+            seeds.generate(data.begin(), data.end());
+            key_ = {data[0], data[1]};
+            counter_ = {0, 0, data[2], data[3]};
+        }
+
+        [[nodiscard]] static constexpr result_type min() noexcept { return 0; }
+        [[nodiscard]] static constexpr result_type max() noexcept {
+            return std::numeric_limits<result_type>::max();
+        }
+
+        constexpr result_type operator()() noexcept {
+            if (index_ == output_.size()) {
+                output_ = generate_block(counter_, key_);
+                increment_counter();
+                index_ = 0;
+            }
+            return output_[index_++];
+        }
+
+        constexpr void discard(unsigned long long count) noexcept {
+            for (; count > 0; --count) (*this)();
+        }
+
+        /// @brief Computes the output block for a counter and key.
+        [[nodiscard]] static constexpr counter_type generate_block(counter_type counter,
+                                                                   key_type key) noexcept {
+            constexpr std::uint64_t multiplier0 = 0xD2511F53u;
+            constexpr std::uint64_t multiplier1 = 0xCD9E8D57u;
+            constexpr std::uint32_t weyl0 = 0x9E3779B9u;
+            constexpr std::uint32_t weyl1 = 0xBB67AE85u;
+
+            for (int round = 0; round < 10; ++round) {
+                const auto product0 = multiplier0 * counter[0];
+                const auto product1 = multiplier1 * counter[2];
+                counter = {static_cast<std::uint32_t>(product1 >> 32u) ^ counter[1] ^ key[0],
+                           static_cast<std::uint32_t>(product1),
+                           static_cast<std::uint32_t>(product0 >> 32u) ^ counter[3] ^ key[1],
+                           static_cast<std::uint32_t>(product0)};
+                key[0] += weyl0;
+                key[1] += weyl1;
+            }
+            return counter;
+        }
+
+        friend constexpr bool operator==(const philox4x32 &, const philox4x32 &) = default;
+
+      private:
+        constexpr void increment_counter() noexcept {
+            for (auto &word : counter_) {
+                if (++word != 0) break;
+            }
+        }
+
+        key_type key_{};
+        counter_type counter_{};
+        counter_type output_{};
+        std::size_t index_{output_.size()};
+    };
+}  // namespace dp::genetic
@@ -1,12 +1,24 @@
 #pragma once
 #include <concepts>
+#include <cstdint>
 #include <random>
 #include <ranges>
 
+#include "genetic/details/random_engines.h"
+
 namespace dp::genetic {
     namespace details {
-        template <class T,
-                  std::size_t NumberOfSeeds = T::state_size * sizeof(typename T::result_type)>
+        /// @brief Number of bytes of seed data needed to fill the state of a random engine.
+        template <class T>
+        constexpr std::size_t random_engine_seed_size() {
+            if constexpr (requires { T::state_size; }) {
+                return T::state_size * sizeof(typename T::result_type);
+            } else {
+                return sizeof(T);
+            }
+        }
+
+        template <class T, std::size_t NumberOfSeeds = random_engine_seed_size<T>()>
         T initialize_random_engine() {
             std::random_device source;
             auto random_data =
@@ -17,28 +29,128 @@ namespace dp::genetic {
         }
 
         template <std::uniform_random_bit_generator T>
-        T initialize_random_engine(const std::seed_seq &seed_seq) {
+        T initialize_random_engine(std::seed_seq &seed_seq) {
             return T(seed_seq);
         }
+
+        /**
+         * @brief Describes the random stream the current thread should draw from.
+         * @details Every time the stream changes the epoch is incremented, which tells the
+         * thread's random engines to re-seed themselves.
+         */
+        struct random_stream_context {
+            bool seeded{false};
+            std::uint_least64_t seed{};
+            std::uint_least64_t stream{};
+            std::uint_least64_t substream{};
+            std::uint_least64_t epoch{};
+        };
+
+        inline random_stream_context &thread_random_stream() {
+            thread_local random_stream_context context{};
+            return context;
+        }
+
+        /**
+         * @brief Returns the random engine of type T for the current thread.
+         * @details Engines are never shared between threads. They are seeded from
+         * std::random_device unless a random_stream_scope is active on the thread, in which case
+         * they are seeded deterministically from the scope's seed and stream.
+         */
+        template <std::uniform_random_bit_generator T>
+        T &thread_random_engine() {
+            thread_local auto engine = initialize_random_engine<T>();
+            thread_local std::uint_least64_t engine_epoch{};
+
+            const auto &context = thread_random_stream();
+            if (engine_epoch != context.epoch) {
+                engine_epoch = context.epoch;
+                if (context.seeded) {
+                    constexpr auto low = [](std::uint_least64_t value) {
+                        return static_cast<std::uint_least32_t>(value & 0xFFFFFFFFu);
+                    };
+                    constexpr auto high = [](std::uint_least64_t value) {
+                        return static_cast<std::uint_least32_t>(value >> 32u);
+                    };
+                    std::seed_seq seeds{low(context.seed),      high(context.seed),
+                                        low(context.stream),    high(context.stream),
+                                        low(context.substream), high(context.substream)};
+                    engine = initialize_random_engine<T>(seeds);
+                } else {
+                    // the scope of a seeded stream ended, do not keep drawing from it
+                    engine = initialize_random_engine<T>();
+                }
+            }
+            return engine;
+        }
+
+        /**
+         * @brief Makes the current thread draw from a deterministic random stream for the
+         * lifetime of the object.
+         * @details Every (seed, stream, substream) combination gives an independent stream. On
+         * destruction the thread goes back to the previous context: the random engines of the
+         * thread are re-seeded from std::random_device, or restart the previous stream if that
+         * was seeded too. The position within the previous stream is not kept.
+         */
+        class random_stream_scope {
+          public:
+            random_stream_scope(std::uint_least64_t seed, std::uint_least64_t stream,
+                                std::uint_least64_t substream = 0)
+                : previous_(thread_random_stream()) {
+                auto &context = thread_random_stream();
+                context.seeded = true;
+                context.seed = seed;
+                context.stream = stream;
+                context.substream = substream;
+                ++context.epoch;
+            }
+
+            ~random_stream_scope() {
+                auto &context = thread_random_stream();
+                const auto epoch = context.epoch;
+                context = previous_;
+                context.epoch = epoch + 1;
+            }
+
+            random_stream_scope(const random_stream_scope &) = delete;
+            random_stream_scope &operator=(const random_stream_scope &) = delete;
+
+          private:
+            random_stream_context previous_;
+        };
     }  // namespace details
 
-    struct uniform_integral_generator {
-        template <std::integral T, std::uniform_random_bit_generator RandomDevice = std::mt19937>
-        auto operator()(const T &lower_bound, const T &upper_bound) {
+    /**
+     * @brief Generates uniformly distributed integers.
+     * @tparam RandomDevice The random engine, i.e. std::mt19937 or dp::genetic::xoshiro256pp.
+     */
+    template <std::uniform_random_bit_generator RandomDevice = std::mt19937>
+    struct basic_uniform_integral_generator {
+        using random_device_type = RandomDevice;
+
+        template <std::integral T>
+        auto operator()(const T &lower_bound, const T &upper_bound) const {
             // generate random crossover points
-            thread_local auto device = details::initialize_random_engine<RandomDevice>();
             std::uniform_int_distribution<T> dist(lower_bound, upper_bound);
-            return dist(device);
+            return dist(details::thread_random_engine<RandomDevice>());
         }
     };
 
-    struct uniform_floating_point_generator {
-        template <std::floating_point T,
-                  std::uniform_random_bit_generator RandomDevice = std::mt19937>
-        auto operator()(const T &lower_bound, const T &upper_bound) {
-            thread_local auto device = details::initialize_random_engine<RandomDevice>();
+    /**
+     * @brief Generates uniformly distributed floating point numbers.
+     * @tparam RandomDevice The random engine, i.e. std::mt19937 or dp::genetic::xoshiro256pp.
+     */
+    template <std::uniform_random_bit_generator RandomDevice = std::mt19937>
+    struct basic_uniform_floating_point_generator {
+        using random_device_type = RandomDevice;
+
+        template <std::floating_point T>
+        auto operator()(const T &lower_bound, const T &upper_bound) const {
             std::uniform_real_distribution<T> dist(lower_bound, upper_bound);
-            return dist(device);
+            return dist(details::thread_random_engine<RandomDevice>());
         }
     };
+
+    using uniform_integral_generator = basic_uniform_integral_generator<>;
+    using uniform_floating_point_generator = basic_uniform_floating_point_generator<>;
 }  // namespace dp::genetic
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <ranges>
+#include <tuple>
+#include <type_traits>
+
+namespace dp::genetic {
+    /**
+     * @brief Executor that runs every task immediately on the calling thread.
+     * @details Useful for small populations where dispatching work to a thread pool costs more
+     * than the work itself, or when the caller is already running many solves in parallel.
+     */
+    struct inline_executor {
+        [[nodiscard]] constexpr std::size_t size() const noexcept { return 1; }
+
+        template <typename Function, typename ReturnType = std::invoke_result_t<Function>>
+        [[nodiscard]] std::future<ReturnType> enqueue(Function&& function) {
+            // exceptions are stored in the future, the same as a thread pool task
+            std::packaged_task<ReturnType()> task(std::forward<Function>(function));
+            auto result = task.get_future();
+            task();
+            return result;
+        }
+    };
+
+    namespace details {
+        /// @brief Calls a function with every future of a range or a tuple of futures.
+        template <typename Futures, typename Function>
+        void for_each_future(Futures& futures, Function&& function) {
+            if constexpr (std::ranges::range<Futures>) {
+                for (auto& future : futures) function(future);
+            } else {
+                std::apply([&function](auto&... future) { (function(future), ...); }, futures);
+            }
+        }
+
+        /**
+         * @brief Waits for every started task when it goes out of scope.
+         * @details Tasks that reference locals of the caller must not still be running when the
+         * caller unwinds, i.e. because enqueue() threw part way through. Futures that were not
+         * started yet (not valid()) are skipped.
+         * @tparam Futures A range or a tuple of futures.
+         */
+        template <typename Futures>
+        class task_wait_guard {
+          public:
+            explicit task_wait_guard(Futures& results) : results_(results) {}
+            ~task_wait_guard() {
+                for_each_future(results_, [](auto& result) {
+                    if (result.valid()) result.wait();
+                });
+            }
+
+            task_wait_guard(const task_wait_guard&) = delete;
+            task_wait_guard& operator=(const task_wait_guard&) = delete;
+
+            /// @brief Waits for every task, then re-throws the first exception of any task.
+            void wait_and_rethrow() {
+                for_each_future(results_, [](auto& result) { result.wait(); });
+                for_each_future(results_, [](auto& result) { result.get(); });
+            }
+
+          private:
+            Futures& results_;
+        };
+    }  // namespace details
+}  // namespace dp::genetic
@@ -1,7 +1,11 @@
 #pragma once
+#include <cassert>
 #include <concepts>
+#include <cstddef>
+#include <functional>
 #include <numeric>
 #include <ranges>
+#include <span>
 
 #include "genetic/details/concepts.h"
 #include "genetic/op/fitness/accumulation.h"
@@ -22,4 +26,69 @@ namespace dp::genetic {
     constexpr T evaluate_fitness(FitnessOp&& fitness_op, const Range& range) {
         return std::invoke(std::forward<FitnessOp>(fitness_op), range);
     }
+
+    /**
+     * @brief Evaluates the fitness of a batch of chromosomes.
+     * @details Batch fitness operators score the whole batch in one call, other fitness
+     * operators are called once per chromosome.
+     * @param fitness_op The fitness operator.
+     * @param chromosomes The chromosomes to score.
+     * @param fitness Receives the fitness of every chromosome, must have the same size.
+     */
+    template <typename T, typename FitnessOp>
+        requires concepts::any_fitness_operator<std::decay_t<FitnessOp>, T>
+    constexpr void evaluate_fitness_batch(FitnessOp&& fitness_op, std::span<const T> chromosomes,
+                                          std::span<double> fitness) {
+        assert(chromosomes.size() == fitness.size());
+        if constexpr (concepts::batch_fitness_operator<std::remove_reference_t<FitnessOp>, T>) {
+            std::invoke(fitness_op, chromosomes, fitness);
+        } else {
+            for (std::size_t i = 0; i < chromosomes.size(); ++i) {
+                fitness[i] = static_cast<double>(std::invoke(fitness_op, chromosomes[i]));
+            }
+        }
+    }
+
+    namespace details {
+        /**
+         * @brief Makes a batch fitness operator callable with a single chromosome.
+         * @details Single chromosomes are scored as a batch of one, batches are passed on. Used
+         * to store batch-only fitness operators in params and static_params, which also need to
+         * score single chromosomes (i.e. for selection operators that take a fitness operator).
+         */
+        template <typename BatchFitness>
+        struct single_from_batch_fitness {
+            // fitness operators are not required to be const callable
+            mutable BatchFitness fitness_op;
+
+            template <typename T>
+                requires concepts::batch_fitness_operator<BatchFitness, T>
+            double operator()(const T& chromosome) const {
+                double fitness{};
+                std::invoke(fitness_op, std::span<const T>(&chromosome, 1),
+                            std::span<double>(&fitness, 1));
+                return fitness;
+            }
+
+            template <typename T>
+                requires concepts::batch_fitness_operator<BatchFitness, T>
+            void operator()(std::span<const T> chromosomes, std::span<double> fitness) const {
+                std::invoke(fitness_op, chromosomes, fitness);
+            }
+        };
+
+        /// @brief Adapts batch-only fitness operators with single_from_batch_fitness, other
+        /// operators are returned as they are.
+        template <typename T, typename FitnessOp>
+            requires concepts::any_fitness_operator<std::decay_t<FitnessOp>, T>
+        [[nodiscard]] constexpr auto make_single_fitness(FitnessOp&& fitness_op) {
+            // decayed, so functions are stored as function pointers
+            using simple_type = std::decay_t<FitnessOp>;
+            if constexpr (concepts::fitness_operator<simple_type, T>) {
+                return simple_type(std::forward<FitnessOp>(fitness_op));
+            } else {
+                return single_from_batch_fitness<simple_type>{std::forward<FitnessOp>(fitness_op)};
+            }
+        }
+    }  // namespace details
 }  // namespace dp::genetic
@@ -0,0 +1,312 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "genetic/details/hash.h"
+#include "genetic/details/memory.h"
+
+namespace dp::genetic {
+    namespace type_traits {
+        template <typename T>
+        concept std_hashable = requires(const T& value) {
+            { std::hash<T>{}(value) } -> std::convertible_to<std::size_t>;
+        };
+    }  // namespace type_traits
+
+    /**
+     * @brief Hash used by fitness_cache, specialize it for your own chromosome types.
+     * @details Uses std::hash when it is available, otherwise ranges of hashable values (i.e.
+     * std::vector<int> or std::array<double, 2>) are hashed element by element. Other types have
+     * no hash and are not cached by solve().
+     */
+    template <typename T>
+    struct chromosome_hash {};
+
+    template <type_traits::std_hashable T>
+    struct chromosome_hash<T> {
+        [[nodiscard]] std::size_t operator()(const T& value) const { return std::hash<T>{}(value); }
+    };
+
+    template <typename T>
+        requires(!type_traits::std_hashable<T> && std::ranges::input_range<const T> &&
+                 type_traits::std_hashable<std::ranges::range_value_t<T>>)
+    struct chromosome_hash<T> {
+        [[nodiscard]] std::size_t operator()(const T& value) const {
+            using value_type = std::ranges::range_value_t<T>;
+            std::size_t seed{0};
+            for (const auto& element : value) {
+                seed = details::hash_combine(seed, std::hash<value_type>{}(element));
+            }
+            return seed;
+        }
+    };
+
+    namespace concepts {
+        /// @brief Chromosomes that fitness_cache can store with the default hash.
+        template <typename T>
+        concept hashable_chromosome =
+            std::equality_comparable<T> && std::copyable<T> &&
+            requires(const T& value) {
+                { chromosome_hash<T>{}(value) } -> std::convertible_to<std::size_t>;
+            };
+    }  // namespace concepts
+
+    /// @brief Number of fitness_cache lookups that found a value and that did not.
+    struct cache_statistics {
+        std::size_t hits{};
+        std::size_t misses{};
+
+        /// @brief Fraction of the lookups that found a value, 0 if there were none.
+        [[nodiscard]] double hit_rate() const {
+            const auto lookups = hits + misses;
+            return lookups == 0 ? 0.0
+                                : static_cast<double>(hits) / static_cast<double>(lookups);
+        }
+    };
+
+    /**
+     * @brief Concurrent memo of the fitness of chromosomes.
+     * @details Populations converge, so late generations mostly consist of chromosomes that
+     * were already evaluated. The cache is split into shards that each have their own lock, so
+     * worker threads rarely wait on each other. The hash of a chromosome is computed once per
+     * lookup and stored with it. Each shard holds at most capacity / shard_count chromosomes.
+     * A full shard evicts a chromosome that was not used recently (CLOCK, or second chance,
+     * eviction: a lookup marks a chromosome as used, and the clock hand skips and unmarks used
+     * chromosomes), so the chromosomes of the current generation stay cached while stale
+     * chromosomes of earlier generations are dropped. The storage of an evicted chromosome is
+     * reused for the new one.
+     *
+     * The fitness operator is called without holding a lock, so two threads may evaluate the
+     * same chromosome at the same time. Both get the same fitness and only one is stored.
+     * @tparam ChromosomeType The chromosome type.
+     * @tparam Hash The hash of a chromosome.
+     * @tparam KeyEqual Compares two chromosomes for equality.
+     */
+    template <typename ChromosomeType, typename Hash = chromosome_hash<ChromosomeType>,
+              typename KeyEqual = std::equal_to<ChromosomeType>>
+    class fitness_cache {
+      public:
+        static constexpr std::size_t shard_count = 16;
+        static_assert(std::has_single_bit(shard_count));
+
+        /**
+         * @brief Creates an empty cache.
+         * @param capacity The maximum number of chromosomes in the cache.
+         * @param hash The chromosome hash.
+         * @param equal The chromosome equality comparison.
+         */
+        explicit fitness_cache(std::size_t capacity, Hash hash = Hash{},
+                               KeyEqual equal = KeyEqual{})
+            : shard_capacity_(std::max<std::size_t>((capacity + shard_count - 1) / shard_count,
+                                                    1)),
+              hash_(std::move(hash)) {
+            for (auto& shard : shards_) {
+                shard.index =
+                    shard_index(0, key_hash{{&shard.slots}}, key_equal{{&shard.slots}, equal});
+            }
+        }
+
+        /**
+         * @brief Returns the cached fitness of a chromosome, evaluating and storing it if it is
+         * not in the cache yet.
+         * @param chromosome The chromosome.
+         * @param fitness_op The fitness operator, only called on a miss.
+         * @return The fitness of the chromosome.
+         */
+        template <typename FitnessOperator>
+        [[nodiscard]] double get_or_evaluate(const ChromosomeType& chromosome,
+                                             FitnessOperator&& fitness_op) {
+            const auto hash = static_cast<std::size_t>(hash_(chromosome));
+            auto& shard = shard_for(hash);
+            if (const auto fitness = find(shard, hash, chromosome)) return *fitness;
+
+            const auto fitness = static_cast<double>(
+                std::invoke(std::forward<FitnessOperator>(fitness_op), chromosome));
+            insert(shard, hash, chromosome, fitness);
+            return fitness;
+        }
+
+        /// @brief The cached fitness of a chromosome, if there is one.
+        [[nodiscard]] std::optional<double> find(const ChromosomeType& chromosome) {
+            const auto hash = static_cast<std::size_t>(hash_(chromosome));
+            return find(shard_for(hash), hash, chromosome);
+        }
+
+        /// @brief Stores the fitness of a chromosome, an existing value is kept.
+        void insert(const ChromosomeType& chromosome, double fitness) {
+            const auto hash = static_cast<std::size_t>(hash_(chromosome));
+            insert(shard_for(hash), hash, chromosome, fitness);
+        }
+
+        /// @brief Number of hits and misses since the cache was created.
+        [[nodiscard]] cache_statistics statistics() const {
+            return {hits_.load(std::memory_order_relaxed),
+                    misses_.load(std::memory_order_relaxed)};
+        }
+
+        /// @brief Number of chromosomes in the cache.
+        [[nodiscard]] std::size_t size() const {
+            std::size_t total_size{};
+            for (const auto& shard : shards_) {
+                std::scoped_lock lock(shard.mutex);
+                total_size += shard.slots.size();
+            }
+            return total_size;
+        }
+
+        /// @brief Removes every chromosome, the statistics are kept.
+        void clear() {
+            for (auto& shard : shards_) {
+                std::scoped_lock lock(shard.mutex);
+                shard.index.clear();
+                shard.slots.clear();
+                shard.hand = 0;
+            }
+        }
+
+      private:
+        struct slot {
+            std::size_t hash;
+            ChromosomeType chromosome;
+            double fitness;
+            // set by a lookup, cleared when the clock hand passes the slot
+            bool referenced;
+        };
+
+        struct lookup_key {
+            std::size_t hash;
+            const ChromosomeType& chromosome;
+        };
+
+        // the index holds the slot numbers of a shard. Hashing and comparison work on the stored
+        // hash, so a chromosome is only hashed once and only chromosomes with the same hash are
+        // compared
+        struct key_view {
+            const std::vector<slot>* slots;
+
+            [[nodiscard]] lookup_key key_of(const lookup_key& key) const { return key; }
+            [[nodiscard]] lookup_key key_of(std::size_t index) const {
+                const auto& stored = (*slots)[index];
+                return {stored.hash, stored.chromosome};
+            }
+        };
+
+        struct key_hash : key_view {
+            using is_transparent = void;
+
+            template <typename Key>
+            [[nodiscard]] std::size_t operator()(const Key& key) const {
+                return this->key_of(key).hash;
+            }
+        };
+
+        struct key_equal : key_view {
+            using is_transparent = void;
+            KeyEqual equal{};
+
+            // every chromosome is stored in one slot only
+            [[nodiscard]] bool operator()(std::size_t first, std::size_t second) const {
+                return first == second;
+            }
+
+            template <typename First, typename Second>
+            [[nodiscard]] bool operator()(const First& first, const Second& second) const {
+                const auto first_key = this->key_of(first);
+                const auto second_key = this->key_of(second);
+                return first_key.hash == second_key.hash &&
+                       equal(first_key.chromosome, second_key.chromosome);
+            }
+        };
+
+        using shard_index = std::unordered_set<std::size_t, key_hash, key_equal>;
+
+        struct shard {
+            mutable std::mutex mutex;
+            std::vector<slot> slots;
+            shard_index index;
+            std::size_t hand{0};
+        };
+
+        [[nodiscard]] shard& shard_for(std::size_t hash) {
+            // std::hash is the identity for integers, so the hash is mixed (Fibonacci hashing)
+            // and the shard is picked with the high bits
+            constexpr auto shift = std::numeric_limits<std::size_t>::digits -
+                                   (std::bit_width(shard_count) - 1);
+            return shards_[(hash * details::golden_ratio) >> shift];
+        }
+
+        std::optional<double> find(shard& shard, std::size_t hash,
+                                   const ChromosomeType& chromosome) {
+            std::scoped_lock lock(shard.mutex);
+            const auto location = shard.index.find(lookup_key{hash, chromosome});
+            if (location == shard.index.end()) {
+                misses_.fetch_add(1, std::memory_order_relaxed);
+                return std::nullopt;
+            }
+            hits_.fetch_add(1, std::memory_order_relaxed);
+            auto& stored = shard.slots[*location];
+            stored.referenced = true;
+            return stored.fitness;
+        }
+
+        void insert(shard& shard, std::size_t hash, const ChromosomeType& chromosome,
+                    double fitness) {
+            std::scoped_lock lock(shard.mutex);
+            if (shard.index.contains(lookup_key{hash, chromosome})) return;
+            if (shard.slots.size() < shard_capacity_) {
+                shard.slots.push_back(slot{hash, stored_copy_of(chromosome), fitness, false});
+                shard.index.insert(shard.slots.size() - 1);
+                return;
+            }
+
+            // give every recently used chromosome a second chance, the first one that was not
+            // used since the hand last passed it is evicted
+            while (shard.slots[shard.hand].referenced) {
+                shard.slots[shard.hand].referenced = false;
+                shard.hand = (shard.hand + 1) % shard.slots.size();
+            }
+            const auto evicted = shard.hand;
+            shard.hand = (shard.hand + 1) % shard.slots.size();
+            // the index node is reused as well
+            auto node = shard.index.extract(evicted);
+
+            // the slot and the storage of the evicted chromosome are reused. Assignment keeps the
+            // allocator of the stored chromosome (i.e. std::pmr containers)
+            auto& stored = shard.slots[evicted];
+            stored.chromosome = chromosome;
+            stored.hash = hash;
+            stored.fitness = fitness;
+            stored.referenced = false;
+            shard.index.insert(std::move(node));
+        }
+
+        // the chromosomes of solve() may allocate from a generation arena that is reset while
+        // the cache still holds them, so stored keys use a default constructed allocator
+        [[nodiscard]] static ChromosomeType stored_copy_of(const ChromosomeType& chromosome) {
+            if constexpr (details::allocator_extended_copyable<ChromosomeType>) {
+                return ChromosomeType(chromosome, typename ChromosomeType::allocator_type{});
+            } else {
+                return chromosome;
+            }
+        }
+
+        std::size_t shard_capacity_;
+        Hash hash_;
+        std::array<shard, shard_count> shards_{};
+        std::atomic<std::size_t> hits_{0};
+        std::atomic<std::size_t> misses_{0};
+    };
+}  // namespace dp::genetic
@@ -3,14 +3,29 @@
 #include <thread_pool/thread_pool.h>
 
 #include <algorithm>
+#include <array>
 #include <concepts>
+#include <cstdint>
 #include <functional>
+#include <future>
 #include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
 #include <numeric>
+#include <optional>
 #include <ranges>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "genetic/details/concepts.h"
+#include "genetic/details/memory.h"
+#include "genetic/details/random_helpers.h"
+#include "genetic/execution.h"
+#include "genetic/fitness_cache.h"
 #include "genetic/params.h"
 #include "genetic/selection.h"
 
@@ -19,46 +34,217 @@ namespace dp {
     namespace genetic {
         namespace details {
             /**
-             * @brief Fitness comparator for the population
-             * @tparam Comparator compare operator (std::less, std::greater, etc)
+             * @brief Finds the fittest individuals of a scored population.
+             * @details Only indices are moved (with a partial selection, not a sort), the
+             * population itself is not modified. The elites are in no particular order.
+             * @param population The scored population.
+             * @param count The number of elites.
+             * @param indices Receives the indices of the elites, its storage is reused.
              */
-            template <typename Comparator = std::less<>>
-            struct fitness_sort_op {
-                template <typename T>
-                bool operator()(const T& first, const T& second) {
-                    Comparator cmp;
-                    return cmp(std::get<double>(first), std::get<double>(second));
+            template <typename Population>
+            void elite_indices(const Population& population, std::size_t count,
+                               std::vector<std::size_t>& indices) {
+                indices.resize(population.size());
+                std::iota(indices.begin(), indices.end(), std::size_t{0});
+                count = std::min(count, indices.size());
+                std::ranges::nth_element(indices,
+                                         indices.begin() + static_cast<std::ptrdiff_t>(count),
+                                         [&population](std::size_t first, std::size_t second) {
+                                             return population[first].second >
+                                                    population[second].second;
+                                         });
+                indices.resize(count);
+            }
+
+            /**
+             * @brief Sorts a scored population by fitness, lowest first.
+             * @details The order is computed on indices, then every individual is moved once
+             * along its permutation cycle instead of being swapped O(log N) times by a
+             * comparison sort, which matters when chromosomes are expensive to move.
+             * @param population The scored population.
+             * @param order Scratch storage for the order, its storage is reused.
+             */
+            template <typename Population>
+            void sort_by_fitness(Population& population, std::vector<std::size_t>& order) {
+                order.resize(population.size());
+                std::iota(order.begin(), order.end(), std::size_t{0});
+                std::ranges::sort(order, [&population](std::size_t first, std::size_t second) {
+                    return population[first].second < population[second].second;
+                });
+
+                // order[i] is the index of the individual that belongs at position i
+                for (std::size_t start = 0; start < order.size(); ++start) {
+                    if (order[start] == start) continue;
+                    auto value = std::move(population[start]);
+                    auto position = start;
+                    while (order[position] != start) {
+                        const auto next = order[position];
+                        population[position] = std::move(population[next]);
+                        order[position] = position;
+                        position = next;
+                    }
+                    population[position] = std::move(value);
+                    order[position] = position;
                 }
-            };
+            }
 
-            struct elitism_op {
-                template <typename Population>
-                constexpr auto operator()(Population&& population,
-                                          std::size_t number_elitism) const {
-                    namespace vw = std::ranges::views;
-                    namespace rng = std::ranges;
-                    // no elitism, so return empty population
-                    if (number_elitism == 0) return vw::take(population, 0);
-
-                    // sort so that largest fitness item is at front
-                    rng::partial_sort(
-                        population,
-                        population.begin() + std::min(population.size(), number_elitism + 1),
-                        details::fitness_sort_op<std::greater<>>{});
-
-                    // select the first n in the current population
-                    return vw::take(population, number_elitism);
+            /**
+             * @brief Calculates how many pairs of children each offspring task should generate.
+             * @param requested_chunk_size User requested chunk size, 0 to pick one automatically.
+             * @param pair_count Total number of pairs of children in the generation.
+             * @param worker_count Number of workers that will share the generation.
+             * @return The number of pairs of children per task, always at least 1.
+             */
+            [[nodiscard]] constexpr std::size_t offspring_chunk_size(
+                std::size_t requested_chunk_size, std::size_t pair_count,
+                std::size_t worker_count) {
+                if (requested_chunk_size > 0) return requested_chunk_size;
+                // a few chunks per worker so that uneven fitness costs still balance out
+                constexpr std::size_t chunks_per_worker = 4;
+                const auto chunk_count = std::max<std::size_t>(worker_count, 1) * chunks_per_worker;
+                return std::max<std::size_t>((pair_count + chunk_count - 1) / chunk_count, 1);
+            }
+
+            /**
+             * @brief Returns true with the given probability.
+             * @details Probabilities of 0 and 1 do not draw a random number, so they do not
+             * change the random stream of the calling thread.
+             */
+            [[nodiscard]] inline bool happens(double probability) {
+                constexpr auto generator = uniform_floating_point_generator{};
+                if (probability <= 0.0) return false;
+                if (probability >= 1.0) return true;
+                return generator(0.0, 1.0) < probability;
+            }
+
+            /**
+             * @brief Finds the parent that a child is equal to, if the comparison is enabled.
+             * @param enabled Whether children are compared with their parents at all.
+             * @param child The child chromosome.
+             * @param first The first scored parent.
+             * @param second The second scored parent.
+             * @return The scored parent that is equal to the child, nullptr if there is none or
+             * the chromosomes can not be compared.
+             */
+            template <typename ChromosomeType, typename ScoredChromosome>
+            [[nodiscard]] const ScoredChromosome* find_equal_parent(
+                bool enabled, const ChromosomeType& child, const ScoredChromosome& first,
+                const ScoredChromosome& second) {
+                if constexpr (std::equality_comparable<ChromosomeType>) {
+                    if (!enabled) return nullptr;
+                    if (child == first.first) return &first;
+                    if (child == second.first) return &second;
                 }
+                return nullptr;
+            }
+
+            /**
+             * @brief Collects scored chromosomes and scores them with one batch fitness call.
+             * @details The chromosomes are moved into contiguous storage for the call and moved
+             * back afterwards, so they are not copied. The storage is reused by every batch.
+             * @tparam ScoredChromosome The (chromosome, fitness) pair type.
+             */
+            template <typename ScoredChromosome>
+            class fitness_batch {
+              public:
+                using chromosome_type = std::tuple_element_t<0, ScoredChromosome>;
+
+                /// @param max_size The maximum batch size, 0 for no limit.
+                explicit fitness_batch(std::size_t max_size)
+                    : max_size_(max_size == 0 ? std::numeric_limits<std::size_t>::max()
+                                              : max_size) {}
+
+                /**
+                 * @brief Adds a chromosome to the batch, it must stay in place until flush().
+                 * @return Whether the batch is full.
+                 */
+                bool add(ScoredChromosome& target) {
+                    pending_.push_back(&target);
+                    return pending_.size() >= max_size_;
+                }
+
+                /**
+                 * @brief Scores every chromosome of the batch and empties it.
+                 * @param fitness_op The batch fitness operator.
+                 * @param on_scored Called with every chromosome once it has its fitness.
+                 */
+                template <typename BatchFitness, typename OnScored>
+                void flush(BatchFitness&& fitness_op, OnScored&& on_scored) {
+                    if (pending_.empty()) return;
+                    for (auto* target : pending_) chromosomes_.push_back(std::move(target->first));
+                    fitness_.resize(chromosomes_.size());
+                    dp::genetic::evaluate_fitness_batch(
+                        fitness_op, std::span<const chromosome_type>(chromosomes_), fitness_);
+                    for (std::size_t i = 0; i < pending_.size(); ++i) {
+                        auto& target = *pending_[i];
+                        target.first = std::move(chromosomes_[i]);
+                        target.second = fitness_[i];
+                        on_scored(std::as_const(target));
+                    }
+                    pending_.clear();
+                    chromosomes_.clear();
+                }
+
+              private:
+                std::size_t max_size_;
+                std::vector<ScoredChromosome*> pending_{};
+                std::vector<chromosome_type> chromosomes_{};
+                std::vector<double> fitness_{};
             };
 
-            inline constexpr auto elitism = elitism_op{};
+            /// @brief Thread pool shared by every solve() that does not request its own executor.
+            inline dp::thread_pool<>& default_worker_pool() {
+                static dp::thread_pool<> worker_pool{};
+                return worker_pool;
+            }
         }  // namespace details
 
         /// @brief Settings type for probabilities
         struct algorithm_settings {
+            /// @brief Fraction of the population that is carried over unchanged.
             double elitism_rate = 0.0;
+            /// @brief Probability that a child is mutated.
             double mutation_rate = 0.5;
-            double crossover_rate = 0.2;
+            /**
+             * @brief Probability that a pair of parents is crossed over.
+             * @details Parents that are not crossed over are passed on to the next generation
+             * as they are (and may still be mutated).
+             */
+            double crossover_rate = 0.8;
+            /// @brief Number of individuals in every generation, 0 keeps the initial size.
+            std::size_t population_size = 0;
+            /**
+             * @brief Compare every child with its parents before evaluating it.
+             * @details A child that is equal to one of its parents gets the fitness of that
+             * parent instead of being evaluated. Enable this when fitness evaluation is much more
+             * expensive than comparing two chromosomes. It has no effect if the chromosome type is
+             * not equality comparable.
+             */
+            bool compare_with_parents = false;
+            /**
+             * @brief Maximum number of chromosomes in the fitness cache, 0 disables it.
+             * @details The cache remembers the fitness of every chromosome that is evaluated, so
+             * chromosomes that come up again in later generations are not evaluated again. Only
+             * chromosomes that satisfy concepts::hashable_chromosome are cached.
+             */
+            std::size_t fitness_cache_capacity = 0;
+            /**
+             * @brief Maximum number of chromosomes per call of a batch fitness operator, 0 scores
+             * all the chromosomes of a worker task in one call.
+             * @details Only used with a concepts::batch_fitness_operator. Every worker task
+             * scores its own children in batches.
+             */
+            std::size_t fitness_batch_size = 0;
+            /// @brief Number of crossover pairs generated per worker task, 0 picks automatically.
+            std::size_t chunk_size = 0;
+            /// @brief Number of worker threads, 0 uses the shared pool and 1 runs inline.
+            std::size_t thread_count = 0;
+            /**
+             * @brief Seed for the random streams of the built-in operators.
+             * @details When set, every offspring task draws from its own stream derived from the
+             * seed, generation and task, so a fixed seed and thread count give identical results.
+             */
+            std::optional<std::uint_least64_t> seed{};
         };
 
         template <typename ChromosomeType>
@@ -72,6 +258,8 @@ namespace dp {
             results<ChromosomeType> current_best;
             std::size_t current_generation_count{};
             std::size_t population_size{};
+            /// @brief Fitness cache lookups of this generation, both 0 if the cache is disabled.
+            cache_statistics fitness_cache_lookups{};
         };
 
         template <typename Fitness>
@@ -79,149 +267,392 @@ namespace dp {
             Fitness fitness_op;
         };
 
-        template <typename PopulationType,
+        /**
+         * @brief Run the genetic algorithm, generating offspring on the given executor.
+         * @details Use this overload to run on your own thread pool (i.e. one that is sized or
+         * pinned for your application, or shared between multiple solves), or with an
+         * inline_executor to run everything on the calling thread. The executor must outlive
+         * the call.
+         *
+         * The operators are not copied for each task: every task calls the same fitness,
+         * selection, crossover and mutation operators, so with more than one worker they must be
+         * safe to call concurrently. Operators with state (counters, their own random engine,
+         * scratch buffers) have to synchronize it or keep it per thread. The built-in operators
+         * only use thread local random engines.
+         * @param executor Executor that runs the offspring generation tasks.
+         * @param initial_population The initial population.
+         * @param settings The algorithm settings.
+         * @param parameters The operators used by the algorithm, either params or static_params.
+         * @param callback Called with the statistics of every generation.
+         * @return The best chromosome that was found and its fitness.
+         */
+        template <typename PopulationType, concepts::executor Executor,
                   typename ChromosomeType = std::ranges::range_value_t<PopulationType>,
+                  typename Parameters = dp::genetic::params<ChromosomeType, PopulationType>,
                   typename IterationCallback =
                       std::function<void(const iteration_statistics<ChromosomeType>&)>>
             requires std::default_initializable<ChromosomeType> &&
                      concepts::population<PopulationType, ChromosomeType>
         results<ChromosomeType> solve(
-            const PopulationType& initial_population, const algorithm_settings& settings,
-            dp::genetic::params<ChromosomeType, PopulationType> parameters = {},
+            Executor& executor, const PopulationType& initial_population,
+            const algorithm_settings& settings,
+            Parameters parameters = Parameters{},
             const IterationCallback& callback = [](const iteration_statistics<ChromosomeType>&) {
             }) {
             using chromosome_metadata = std::pair<ChromosomeType, double>;
             using population = std::vector<chromosome_metadata>;
             using iteration_stats = iteration_statistics<ChromosomeType>;
-            namespace vw = std::ranges::views;
             namespace rng = std::ranges;
 
-            static dp::thread_pool worker_pool{};
+            // chromosomes that allocate from a std::pmr::memory_resource (i.e. std::pmr::string)
+            // are allocated from an arena that belongs to their population buffer. The arenas
+            // must outlive the populations.
+            constexpr bool use_arenas = type_traits::uses_memory_resource<ChromosomeType>;
+            [[maybe_unused]] std::conditional_t<use_arenas, std::array<generation_arena, 2>,
+                                                std::tuple<>>
+                arenas{};
+            [[maybe_unused]] std::size_t current_arena{0};
+
+            // fitness is looked up in the cache first when it is enabled. The cache is shared
+            // by all the tasks, it outlives them like the populations.
+            constexpr bool use_cache = concepts::hashable_chromosome<ChromosomeType>;
+            [[maybe_unused]] std::conditional_t<use_cache,
+                                                std::optional<fitness_cache<ChromosomeType>>,
+                                                std::tuple<>>
+                cache{};
+            if constexpr (use_cache) {
+                if (settings.fitness_cache_capacity > 0) {
+                    cache.emplace(settings.fitness_cache_capacity);
+                }
+            }
+            // with a batch fitness operator, individuals are collected in a batch and only get
+            // their fitness when the batch is flushed. Every task has its own batch.
+            using batch_type = details::fitness_batch<chromosome_metadata>;
+            const auto flush = [&parameters, &cache](batch_type& batch) {
+                batch.flush(parameters.batch_fitness_operator(),
+                            [&cache]([[maybe_unused]] const chromosome_metadata& individual) {
+                                if constexpr (use_cache) {
+                                    if (cache) cache->insert(individual.first, individual.second);
+                                }
+                            });
+            };
+            const auto score = [&parameters, &cache, &flush](chromosome_metadata& individual,
+                                                             batch_type& batch) {
+                auto& [chromosome, fitness] = individual;
+                if (!parameters.has_batch_fitness()) {
+                    if constexpr (use_cache) {
+                        if (cache) {
+                            fitness =
+                                cache->get_or_evaluate(chromosome, parameters.fitness_operator());
+                            return;
+                        }
+                    }
+                    fitness = static_cast<double>(
+                        dp::genetic::evaluate_fitness(parameters.fitness_operator(), chromosome));
+                    return;
+                }
+                if constexpr (use_cache) {
+                    if (cache) {
+                        if (const auto cached = cache->find(chromosome)) {
+                            fitness = *cached;
+                            return;
+                        }
+                    }
+                }
+                if (batch.add(individual)) flush(batch);
+            };
+            const auto cache_lookups = [&cache] {
+                if constexpr (use_cache) {
+                    if (cache) return cache->statistics();
+                }
+                return dp::genetic::cache_statistics{};
+            };
 
+            // the population is double buffered, every generation is written into the storage of
+            // the generation before the current one and then the buffers are swapped. Children
+            // are written into the chromosomes they replace, so once the buffers are warmed up
+            // a generation of the same size does not allocate any chromosome storage.
             population current_population;
-            // initialize our population
-            rng::transform(
-                initial_population, std::back_inserter(current_population),
-                [&](ChromosomeType value) {
-                    return chromosome_metadata{
-                        value, dp::genetic::evaluate_fitness(parameters.fitness_operator(), value)};
-                });
-            // sort by fitness
-            rng::sort(current_population, details::fitness_sort_op{});
+            population next_population;
+            if constexpr (rng::sized_range<PopulationType>) {
+                current_population.reserve(rng::size(initial_population));
+            }
+            // initialize our population, this is the only copy of the initial chromosomes
+            rng::transform(initial_population, std::back_inserter(current_population),
+                           [&](const ChromosomeType& value) {
+                               if constexpr (use_arenas) {
+                                   return chromosome_metadata{
+                                       std::make_obj_using_allocator<ChromosomeType>(
+                                           std::pmr::polymorphic_allocator<>(
+                                               &arenas[current_arena]),
+                                           value),
+                                       0.0};
+                               } else {
+                                   return chromosome_metadata{value, 0.0};
+                               }
+                           });
+            {
+                batch_type batch(settings.fitness_batch_size);
+                for (auto& individual : current_population) score(individual, batch);
+                flush(batch);
+            }
+            // index storage for sorting and elitism, reused by every generation
+            std::vector<std::size_t> sort_order{};
+            std::vector<std::size_t> elites{};
+            // only sort when the selection operator needs it, nothing else depends on the order
+            if (parameters.requires_sorted_population()) {
+                details::sort_by_fitness(current_population, sort_order);
+            }
 
-            auto best_element = *rng::max_element(
-                current_population, [](const std::pair<ChromosomeType, double>& first,
-                                       const std::pair<ChromosomeType, double>& second) {
-                    return std::get<double>(first) < std::get<double>(second);
-                });
+            const auto by_fitness = &chromosome_metadata::second;
+            auto best_element = *rng::max_element(current_population, {}, by_fitness);
 
             iteration_stats stats{};
             stats.current_best.best = std::get<ChromosomeType>(best_element);
             stats.current_best.fitness = std::get<double>(best_element);
 
+            // every generation has the same size, so the buffers are only filled once
+            const auto population_size = settings.population_size != 0
+                                              ? settings.population_size
+                                              : current_population.size();
+
+            auto previous_lookups = cache_lookups();
+
             while (!dp::genetic::should_terminate(parameters.termination_operator(),
                                                   std::get<ChromosomeType>(best_element),
                                                   std::get<double>(best_element))) {
-                auto number_elitism = static_cast<std::size_t>(std::round(
-                    static_cast<double>(current_population.size()) * settings.elitism_rate));
+                auto number_elitism = static_cast<std::size_t>(
+                    std::round(static_cast<double>(population_size) * settings.elitism_rate));
                 // perform elitism selection if it is enabled
                 if (number_elitism == 0 && settings.elitism_rate > 0.0) number_elitism = 2;
-                // generate elite population
-                auto elite_population = details::elitism(current_population, number_elitism);
-
-                // cross over
-                auto crossover_number = static_cast<std::size_t>(std::round(
-                    static_cast<double>(current_population.size()) * settings.crossover_rate));
-                if (crossover_number <= 1) crossover_number = 4;
-
-                // create a new "generation", we will also insert the elite population into this one
-                std::vector<std::future<std::pair<chromosome_metadata, chromosome_metadata>>>
-                    future_results{};
-                future_results.reserve(crossover_number);
-
-                for (std::size_t i = 0; i < crossover_number; i++) {
-                    std::future<std::pair<chromosome_metadata, chromosome_metadata>> future =
-                        worker_pool.enqueue(
-                            [](params<ChromosomeType, PopulationType> prms, const population& pop)
-                                -> std::pair<chromosome_metadata, chromosome_metadata> {
-                                // randomly select 2 parents
-                                auto chromosomes_only_view = pop | std::views::elements<0> |
-                                                             std::ranges::to<PopulationType>();
-                                auto [parent1, parent2] = dp::genetic::select_parents(
-                                    prms.selection_operator(), chromosomes_only_view,
-                                    [&prms](const auto& values) {
-                                        return genetic::evaluate_fitness(prms.fitness_operator(),
-                                                                         values);
-                                    });
-
-                                // generate two children from each parent sets
-                                auto child1 = dp::genetic::make_children(prms.crossover_operator(),
-                                                                         parent1, parent2);
-                                auto child2 = dp::genetic::make_children(prms.crossover_operator(),
-                                                                         parent2, parent1);
-
-                                // mutate the children
-                                child1 = dp::genetic::mutate(prms.mutation_operator(), child1);
-                                child2 = dp::genetic::mutate(prms.mutation_operator(), child2);
-
-                                // return the result + their fitness
-                                return std::make_pair(
-                                    std::make_pair(child1, dp::genetic::evaluate_fitness(
-                                                               prms.fitness_operator(), child1)),
-                                    std::make_pair(child2, dp::genetic::evaluate_fitness(
-                                                               prms.fitness_operator(), child2)));
-                            },
-                            parameters, current_population);
-                    future_results.emplace_back(std::move(future));
+                // leave room for at least two children, otherwise the population never changes
+                const auto max_elitism =
+                    population_size - std::min(population_size, std::size_t{2});
+                number_elitism = std::min(number_elitism, max_elitism);
+                // find the elites, they are taken out of the population once the children exist
+                details::elite_indices(current_population, number_elitism, elites);
+
+                // the rest of the generation is children, created in pairs from two parents. With
+                // an odd number of children the last pair only has one child.
+                const auto children_count = population_size - elites.size();
+                const auto pair_count = (children_count + 1) / 2;
+
+                // the new generation is the children followed by the elites. Resizing keeps the
+                // chromosomes (and their storage) of the previous generation in the buffer.
+                if constexpr (use_arenas) {
+                    // nothing references the chromosomes in the buffer anymore, so its arena is
+                    // reset and the buffer is refilled with empty chromosomes that allocate from
+                    // it. The arena keeps its memory, so this does not allocate either.
+                    auto& arena = arenas[1 - current_arena];
+                    next_population.clear();
+                    arena.reset();
+                    const std::pmr::polymorphic_allocator<> allocator(&arena);
+                    for (std::size_t i = 0; i < population_size; ++i) {
+                        next_population.emplace_back(
+                            std::make_obj_using_allocator<ChromosomeType>(allocator), 0.0);
+                    }
+                } else {
+                    next_population.resize(population_size);
                 }
 
-                population crossover_population;
-                crossover_population.reserve(crossover_number * 2 + elite_population.size());
-
-                for (auto& result : future_results) {
-                    auto [child1, child2] = result.get();
-                    crossover_population.push_back(child1);
-                    crossover_population.push_back(child2);
+                // read-only snapshot of this generation that is shared by all the tasks. The
+                // tasks reference it (and the parameters) directly instead of copying them; this
+                // is safe because solve() waits for every task before it replaces the population
+                // or unwinds, also when a task throws.
+                const population& generation = current_population;
+                const auto& prms = parameters;
+
+                // prepare selection once for the whole generation (i.e. build cumulative fitness
+                // tables), every pair of parents is then drawn from the same selector. Like any
+                // other operator, it is shared by all the tasks.
+                auto parent_selector = prms.parent_selector(generation);
+
+                // each task generates a contiguous block of children, so we only pay for one
+                // future per chunk instead of one per pair of children
+                const auto chunk_size =
+                    details::offspring_chunk_size(settings.chunk_size, pair_count, executor.size());
+                std::vector<std::future<void>> chunk_results{};
+                chunk_results.reserve((pair_count + chunk_size - 1) / chunk_size);
+                details::task_wait_guard wait_for_tasks(chunk_results);
+
+                const auto generation_number = stats.current_generation_count;
+                for (std::size_t first = 0; first < pair_count; first += chunk_size) {
+                    const auto last = std::min(first + chunk_size, pair_count);
+                    chunk_results.emplace_back(executor.enqueue(
+                        [&prms, &parent_selector, &score, &flush, &output = next_population,
+                         &settings, generation_number, children_count, first, last]() {
+                            // each chunk gets its own random stream, so results do not depend on
+                            // which thread runs the chunk
+                            std::optional<details::random_stream_scope> random_stream{};
+                            if (settings.seed) {
+                                random_stream.emplace(*settings.seed, generation_number, first);
+                            }
+
+                            // storage for parents that selection returns by value, reused for
+                            // every pair of the chunk
+                            std::pair<chromosome_metadata, chromosome_metadata> parent_buffer{};
+                            batch_type batch(settings.fitness_batch_size);
+                            for (auto i = first; i < last; ++i) {
+                                // randomly select 2 parents, using the fitness we already
+                                // computed for the current population. The parents are only
+                                // read, so they are not copied.
+                                const auto [parent1, parent2] = parent_selector(parent_buffer);
+                                const bool crossover = details::happens(settings.crossover_rate);
+                                const bool both_children = 2 * i + 1 < children_count;
+
+                                // pair operators make both children of the parents in one pass
+                                const bool crossed_pair =
+                                    crossover && both_children && prms.has_pair_crossover();
+                                if (crossed_pair) {
+                                    dp::genetic::make_children_pair_into(
+                                        prms.crossover_pair_operator(), parent1.first,
+                                        parent2.first, output[2 * i].first,
+                                        output[2 * i + 1].first);
+                                }
+
+                                // generate up to two children from each parent set, writing them
+                                // into the chromosomes they replace
+                                const auto make_child = [&](const chromosome_metadata& parent,
+                                                            const chromosome_metadata& other,
+                                                            chromosome_metadata& child) {
+                                    auto& [chromosome, fitness] = child;
+                                    if (!crossover) {
+                                        chromosome = parent.first;
+                                    } else if (!crossed_pair) {
+                                        dp::genetic::make_children_into(prms.crossover_operator(),
+                                                                        parent.first, other.first,
+                                                                        chromosome);
+                                    }
+
+                                    // operators that never change the chromosome are skipped
+                                    const bool mutation =
+                                        prms.mutation_modifies_chromosome() &&
+                                        details::happens(settings.mutation_rate);
+                                    if (mutation) {
+                                        dp::genetic::mutate_in_place(prms.mutation_operator(),
+                                                                     chromosome);
+                                    }
+
+                                    // only evaluate children that may differ from their parents,
+                                    // the others keep the fitness of the parent they equal
+                                    if (!crossover && !mutation) {
+                                        fitness = parent.second;
+                                    } else if (const auto* const equal_parent =
+                                                   details::find_equal_parent(
+                                                       settings.compare_with_parents, chromosome,
+                                                       parent, other)) {
+                                        fitness = equal_parent->second;
+                                    } else {
+                                        score(child, batch);
+                                    }
+                                };
+
+                                make_child(parent1, parent2, output[2 * i]);
+                                if (both_children) {
+                                    make_child(parent2, parent1, output[2 * i + 1]);
+                                }
+                            }
+                            // score the children that are still waiting in the batch
+                            flush(batch);
+                        }));
                 }
 
-                if (!rng::empty(elite_population)) {
-                    // add elite population directly to new population
-                    crossover_population.insert(crossover_population.end(),
-                                                elite_population.begin(), elite_population.end());
+                // wait for all the children before any exception of a task is re-thrown, the
+                // other tasks still use the locals of solve()
+                wait_for_tasks.wait_and_rethrow();
+
+                for (std::size_t i = 0; i < elites.size(); ++i) {
+                    auto& elite = current_population[elites[i]];
+                    auto& slot = next_population[children_count + i];
+                    if constexpr (use_arenas) {
+                        // copy the elites so that they are allocated from the arena of the new
+                        // population, the arena of the current population is reset next
+                        // generation
+                        slot = elite;
+                    } else {
+                        // swap the elites into the new population, the current population is
+                        // recycled below so the elites can be taken out of it. Their slot in the
+                        // current population gets the storage of the chromosome they replace.
+                        std::ranges::swap(slot, elite);
+                    }
                 }
 
-                // sort crossover population by fitness (lowest first)
-                rng::sort(crossover_population, details::fitness_sort_op{});
-
-                // reset the current population
-                current_population.clear();
-                // assign/move the new generation
-                current_population = std::move(crossover_population);
-
                 // update the best element
-                auto temp_best_element = *rng::max_element(current_population);
-                const auto [element, best_fitness] = temp_best_element;
-                const auto previous_best_fitness = std::get<double>(best_element);
-                if (std::abs(best_fitness - previous_best_fitness) > 0.0) {
-                    // better fitness
-                    best_element = temp_best_element;
-                } else {
-                    // current best did not improve previous best
-                    // insert previous best into the current population
-                    if (!current_population.empty()) current_population[0] = best_element;
+                if (!next_population.empty()) {
+                    const auto& generation_best =
+                        *rng::max_element(next_population, {}, by_fitness);
+                    if (generation_best.second > best_element.second) {
+                        // better fitness
+                        best_element = generation_best;
+                    } else {
+                        // current best did not improve previous best, insert the previous best
+                        // into the new population in place of the worst individual
+                        *rng::min_element(next_population, {}, by_fitness) = best_element;
+                    }
                 }
 
+                if (prms.requires_sorted_population()) {
+                    details::sort_by_fitness(next_population, sort_order);
+                }
+
+                // the new generation becomes the current one, the old generation is kept as the
+                // storage for the next one
+                current_population.swap(next_population);
+                if constexpr (use_arenas) current_arena = 1 - current_arena;
+
                 // send callback stats for each generation
                 stats.current_best.best = std::get<ChromosomeType>(best_element);
                 stats.current_best.fitness = std::get<double>(best_element);
                 stats.population_size = current_population.size();
+                const auto lookups = cache_lookups();
+                stats.fitness_cache_lookups = {lookups.hits - previous_lookups.hits,
+                                               lookups.misses - previous_lookups.misses};
+                previous_lookups = lookups;
                 ++stats.current_generation_count;
-                callback(std::add_const_t<iteration_stats>(stats));
+                callback(std::as_const(stats));
             }
 
             return {std::get<ChromosomeType>(best_element), std::get<double>(best_element)};
         }
 
+        /**
+         * @brief Run the genetic algorithm.
+         * @details The executor is picked with algorithm_settings::thread_count. By default the
+         * offspring are generated on a thread pool that is shared by every solve in the process.
+         * Unless thread_count is 1, the operators are called concurrently, see the executor
+         * overload.
+         * @param initial_population The initial population.
+         * @param settings The algorithm settings.
+         * @param parameters The operators used by the algorithm, either params or static_params.
+         * @param callback Called with the statistics of every generation.
+         * @return The best chromosome that was found and its fitness.
+         */
+        template <typename PopulationType,
+                  typename ChromosomeType = std::ranges::range_value_t<PopulationType>,
+                  typename Parameters = dp::genetic::params<ChromosomeType, PopulationType>,
+                  typename IterationCallback =
+                      std::function<void(const iteration_statistics<ChromosomeType>&)>>
+            requires std::default_initializable<ChromosomeType> &&
+                     concepts::population<PopulationType, ChromosomeType>
+        results<ChromosomeType> solve(
+            const PopulationType& initial_population, const algorithm_settings& settings,
+            Parameters parameters = Parameters{},
+            const IterationCallback& callback = [](const iteration_statistics<ChromosomeType>&) {
+            }) {
+            if (settings.thread_count == 1) {
+                inline_executor executor{};
+                return solve(executor, initial_population, settings, std::move(parameters),
+                             callback);
+            }
+            if (settings.thread_count > 1) {
+                dp::thread_pool executor(static_cast<unsigned int>(settings.thread_count));
+                return solve(executor, initial_population, settings, std::move(parameters),
+                             callback);
+            }
+            return solve(details::default_worker_pool(), initial_population, settings,
+                         std::move(parameters), callback);
+        }
+
         namespace experimental {
             template <typename PopulationType,
                       typename ChromosomeType = std::ranges::range_value_t<PopulationType>>
@@ -1,10 +1,15 @@
 #pragma once
 
 #include <algorithm>
+#include <functional>
 #include <random>
+#include <type_traits>
+#include <utility>
 
 #include "details/random_helpers.h"
 #include "genetic/details/concepts.h"
+#include "genetic/details/memory.h"
+#include "genetic/op/mutation/bit_flip.h"
 #include "genetic/op/mutation/composite_mutation.h"
 #include "genetic/op/mutation/no_op.h"
 #include "genetic/op/mutation/value_generator.h"
@@ -13,18 +18,68 @@
 #include "genetic/op/mutation/value_replacement.h"
 
 namespace dp::genetic {
+    namespace details {
+        /**
+         * @brief Whether a mutation operator can change the chromosome it is given.
+         * @details Operators that never change a chromosome (i.e. no_op_mutator) declare a
+         * `static constexpr bool modifies_chromosome = false` member. solve() then skips them
+         * and keeps the fitness of the chromosome instead of evaluating it again.
+         * @tparam Mutator The mutation operator.
+         */
+        template <typename Mutator, typename SimpleType = std::remove_cvref_t<Mutator>>
+        [[nodiscard]] constexpr bool mutation_modifies_chromosome() {
+            if constexpr (requires { SimpleType::modifies_chromosome; }) {
+                return SimpleType::modifies_chromosome;
+            } else {
+                return true;
+            }
+        }
+    }  // namespace details
 
     /**
      * @brief Mutate a value using the provided mutation operator.
      *
      * @tparam T The input value type.
      * @tparam Mutator The mutation operator.
-     * @param mutator The mutation operator, takes in a value and returns a mutated value.
-     * @param input_value The input value to mutate.
+     * @param mutator The mutation operator, either takes in a value and returns a mutated value
+     * or mutates a value in place.
+     * @param input_value The input value to mutate. Pass an rvalue to let the mutation operator
+     * reuse it instead of copying it.
      * @return The mutated value.
      */
-    template <typename T, dp::genetic::concepts::mutation_operator<T> Mutator>
-    [[nodiscard]] constexpr T mutate(Mutator&& mutator, const T& input_value) {
-        return std::invoke(std::forward<Mutator>(mutator), input_value);
+    template <typename T, typename Mutator, typename SimpleType = std::remove_cvref_t<T>>
+        requires dp::genetic::concepts::any_mutation_operator<Mutator, SimpleType>
+    [[nodiscard]] constexpr SimpleType mutate(Mutator&& mutator, T&& input_value) {
+        if constexpr (dp::genetic::concepts::in_place_mutation_operator<Mutator, SimpleType>) {
+            if constexpr (std::is_lvalue_reference_v<T>) {
+                // copies keep the allocator of the input value
+                SimpleType value = details::copy_of(input_value);
+                std::invoke(std::forward<Mutator>(mutator), value);
+                return value;
+            } else {
+                SimpleType value(std::move(input_value));
+                std::invoke(std::forward<Mutator>(mutator), value);
+                return value;
+            }
+        } else {
+            return std::invoke(std::forward<Mutator>(mutator), std::forward<T>(input_value));
+        }
+    }
+
+    /**
+     * @brief Mutate a value in place using the provided mutation operator.
+     * @details In place mutation operators are called directly. Operators that return a new
+     * value are given the value as an rvalue and the result is moved back into it, so the value
+     * is never copied by this function.
+     * @param mutator The mutation operator.
+     * @param value The value to mutate.
+     */
+    template <typename T, dp::genetic::concepts::any_mutation_operator<T> Mutator>
+    constexpr void mutate_in_place(Mutator&& mutator, T& value) {
+        if constexpr (dp::genetic::concepts::in_place_mutation_operator<Mutator, T>) {
+            std::invoke(std::forward<Mutator>(mutator), value);
+        } else {
+            value = std::invoke(std::forward<Mutator>(mutator), std::move(value));
+        }
     }
 }  // namespace dp::genetic
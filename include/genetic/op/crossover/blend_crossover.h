@@ -0,0 +1,172 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <random>
+#include <ranges>
+#include <utility>
+
+#include "genetic/details/concepts.h"
+#include "genetic/details/crossover_helpers.h"
+#include "genetic/details/memory.h"
+#include "genetic/details/random_helpers.h"
+
+namespace dp::genetic {
+    namespace details {
+        /**
+         * @brief Combines the shared genes of two real valued parents into one or two children.
+         * @details combine(a, b) returns the gene of the first child and the gene of the second
+         * child. Genes that the shorter parent does not have are copied from the parent of the
+         * child.
+         */
+        template <bool BothChildren, typename T, typename Combine>
+        void blend_genes(const T &first, const T &second, T &first_child, T &second_child,
+                         Combine &&combine) {
+            const auto first_size = static_cast<std::size_t>(std::ranges::size(first));
+            const auto second_size = static_cast<std::size_t>(std::ranges::size(second));
+            resize_child(first_child, first_size);
+            if constexpr (BothChildren) resize_child(second_child, second_size);
+
+            const auto shared_size = std::min(first_size, second_size);
+            const auto first_genes = std::ranges::begin(first);
+            const auto second_genes = std::ranges::begin(second);
+            const auto first_child_genes = std::ranges::begin(first_child);
+            const auto second_child_genes = std::ranges::begin(second_child);
+            for (std::size_t index = 0; index < shared_size; ++index) {
+                const auto gene = static_cast<std::ranges::range_difference_t<T>>(index);
+                const auto [first_gene, second_gene] =
+                    combine(first_genes[gene], second_genes[gene]);
+                first_child_genes[gene] = first_gene;
+                if constexpr (BothChildren) second_child_genes[gene] = second_gene;
+            }
+            copy_tail(first, first_child, shared_size);
+            if constexpr (BothChildren) copy_tail(second, second_child, shared_size);
+        }
+    }  // namespace details
+
+    /**
+     * @brief Blend crossover (BLX-alpha) for real valued chromosomes.
+     * @details Every gene of the child is drawn uniformly from the interval spanned by the genes
+     * of the parents, extended by alpha times its width on both sides. The second child of a
+     * pair is the first child mirrored about the midpoint of the parents, so both children need
+     * one random number per gene.
+     * @tparam RandomDevice The random engine.
+     */
+    template <std::uniform_random_bit_generator RandomDevice = std::mt19937>
+    struct basic_blend_crossover {
+        /// @param alpha How far the children may lie outside the interval of the parents.
+        explicit basic_blend_crossover(double alpha = 0.5) : alpha_(alpha) {}
+
+        /**
+         * @brief Writes the child of two parents into an existing chromosome.
+         * @param first The first parent.
+         * @param second The second parent.
+         * @param child The output child, must not be one of the parents.
+         */
+        template <concepts::real_valued_chromosome T>
+        void operator()(const T &first, const T &second, T &child) const {
+            cross<false>(first, second, child, child);
+        }
+
+        /// @brief Writes both children of two parents.
+        template <concepts::real_valued_chromosome T>
+        void operator()(const T &first, const T &second, T &first_child, T &second_child) const {
+            cross<true>(first, second, first_child, second_child);
+        }
+
+        /// @brief Returns the child of two parents.
+        template <concepts::real_valued_chromosome T>
+            requires std::default_initializable<T>
+        [[nodiscard]] T operator()(const T &first, const T &second) const {
+            auto child = details::empty_like(first);
+            (*this)(first, second, child);
+            return child;
+        }
+
+      private:
+        template <bool BothChildren, typename T>
+        void cross(const T &first, const T &second, T &first_child, T &second_child) const {
+            using gene_type = std::ranges::range_value_t<T>;
+            auto &engine = details::thread_random_engine<RandomDevice>();
+            // scaled per gene, so one distribution serves every interval
+            std::uniform_real_distribution<gene_type> unit{};
+            const auto alpha = static_cast<gene_type>(alpha_);
+            details::blend_genes<BothChildren>(
+                first, second, first_child, second_child, [&](gene_type a, gene_type b) {
+                    const auto width = std::abs(a - b);
+                    const auto lower = std::min(a, b) - alpha * width;
+                    const auto child = lower + (width + 2 * alpha * width) * unit(engine);
+                    return std::pair{child, a + b - child};
+                });
+        }
+
+        double alpha_;
+    };
+
+    /**
+     * @brief Whole arithmetic crossover for real valued chromosomes.
+     * @details The first child is weight * first + (1 - weight) * second and the second child
+     * is the mirror image, weight * second + (1 - weight) * first. The weight is either fixed
+     * or drawn uniformly from [0, 1] once per pair of parents.
+     * @tparam RandomDevice The random engine.
+     */
+    template <std::uniform_random_bit_generator RandomDevice = std::mt19937>
+    struct basic_arithmetic_crossover {
+        /// @brief Draws a new weight for every pair of parents.
+        basic_arithmetic_crossover() = default;
+
+        /// @param weight The weight of the first parent in the first child, in [0, 1].
+        explicit basic_arithmetic_crossover(double weight) : weight_(weight) {}
+
+        /**
+         * @brief Writes the child of two parents into an existing chromosome.
+         * @param first The first parent.
+         * @param second The second parent.
+         * @param child The output child, must not be one of the parents.
+         */
+        template <concepts::real_valued_chromosome T>
+        void operator()(const T &first, const T &second, T &child) const {
+            cross<false>(first, second, child, child);
+        }
+
+        /// @brief Writes both children of two parents.
+        template <concepts::real_valued_chromosome T>
+        void operator()(const T &first, const T &second, T &first_child, T &second_child) const {
+            cross<true>(first, second, first_child, second_child);
+        }
+
+        /// @brief Returns the child of two parents.
+        template <concepts::real_valued_chromosome T>
+            requires std::default_initializable<T>
+        [[nodiscard]] T operator()(const T &first, const T &second) const {
+            auto child = details::empty_like(first);
+            (*this)(first, second, child);
+            return child;
+        }
+
+      private:
+        template <bool BothChildren, typename T>
+        void cross(const T &first, const T &second, T &first_child, T &second_child) const {
+            using gene_type = std::ranges::range_value_t<T>;
+            const auto weight = static_cast<gene_type>(
+                weight_.has_value()
+                    ? *weight_
+                    : std::uniform_real_distribution<double>{0.0, 1.0}(
+                          details::thread_random_engine<RandomDevice>()));
+            details::blend_genes<BothChildren>(
+                first, second, first_child, second_child, [weight](gene_type a, gene_type b) {
+                    return std::pair{weight * a + (1 - weight) * b,
+                                     weight * b + (1 - weight) * a};
+                });
+        }
+
+        std::optional<double> weight_{};
+    };
+
+    using blend_crossover = basic_blend_crossover<>;
+    using arithmetic_crossover = basic_arithmetic_crossover<>;
+}  // namespace dp::genetic
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <utility>
+
+#include "genetic/details/concepts.h"
+#include "genetic/details/crossover_helpers.h"
+#include "genetic/details/memory.h"
+#include "genetic/details/random_helpers.h"
+
+namespace dp::genetic {
+    /**
+     * @brief Splits both parents at the same Points pivots and alternates between their
+     * segments.
+     * @details Unlike random_crossover, both parents are split at the same positions, so the
+     * child has the size of the first parent; genes that the second parent does not have are
+     * taken from the first parent. Segments are copied as a whole into the existing child, and
+     * both children of two parents are made in one pass.
+     * @tparam Points The number of pivots.
+     * @tparam IndexProvider Generates the pivot indices.
+     */
+    template <std::size_t Points = 2, dp::genetic::concepts::index_generator IndexProvider =
+                                          genetic::uniform_integral_generator>
+        requires(Points > 0)
+    struct basic_k_point_crossover {
+        /**
+         * @brief Writes the child of two parents into an existing chromosome.
+         * @param first The first parent.
+         * @param second The second parent.
+         * @param child The output child, must not be one of the parents.
+         */
+        template <std::ranges::random_access_range T>
+            requires std::ranges::sized_range<T> &&
+                     std::indirectly_writable<std::ranges::iterator_t<T>,
+                                              std::ranges::range_value_t<T>>
+        void operator()(const T &first, const T &second, T &child) const {
+            cross<false>(first, second, child, child);
+        }
+
+        /// @brief Writes both children of two parents, the second child takes the segments
+        /// the first child does not.
+        template <std::ranges::random_access_range T>
+            requires std::ranges::sized_range<T> &&
+                     std::indirectly_writable<std::ranges::iterator_t<T>,
+                                              std::ranges::range_value_t<T>>
+        void operator()(const T &first, const T &second, T &first_child, T &second_child) const {
+            cross<true>(first, second, first_child, second_child);
+        }
+
+        /// @brief Returns the child of two parents.
+        template <std::ranges::random_access_range T>
+            requires std::ranges::sized_range<T> && std::default_initializable<T>
+        [[nodiscard]] T operator()(const T &first, const T &second) const {
+            auto child = details::empty_like(first);
+            (*this)(first, second, child);
+            return child;
+        }
+
+      private:
+        template <bool BothChildren, typename T>
+        static void cross(const T &first, const T &second, T &first_child, T &second_child) {
+            using difference_type = std::ranges::range_difference_t<T>;
+            const auto first_size = static_cast<std::size_t>(std::ranges::size(first));
+            const auto second_size = static_cast<std::size_t>(std::ranges::size(second));
+            details::resize_child(first_child, first_size);
+            if constexpr (BothChildren) details::resize_child(second_child, second_size);
+
+            const auto shared_size = std::min(first_size, second_size);
+            IndexProvider index_provider{};
+            std::array<std::size_t, Points> pivots{};
+            for (auto &pivot : pivots) pivot = index_provider(std::size_t{0}, shared_size);
+            std::ranges::sort(pivots);
+
+            const auto copy_segment = [](const T &parent, T &child, std::size_t begin,
+                                         std::size_t end) {
+                const auto parent_begin = std::ranges::begin(parent);
+                std::copy(parent_begin + static_cast<difference_type>(begin),
+                          parent_begin + static_cast<difference_type>(end),
+                          std::ranges::begin(child) + static_cast<difference_type>(begin));
+            };
+            std::size_t segment_begin{0};
+            bool from_first = true;
+            for (const auto segment_end : pivots) {
+                copy_segment(from_first ? first : second, first_child, segment_begin,
+                             segment_end);
+                if constexpr (BothChildren) {
+                    copy_segment(from_first ? second : first, second_child, segment_begin,
+                                 segment_end);
+                }
+                segment_begin = segment_end;
+                from_first = !from_first;
+            }
+            copy_segment(from_first ? first : second, first_child, segment_begin, shared_size);
+            details::copy_tail(first, first_child, shared_size);
+            if constexpr (BothChildren) {
+                copy_segment(from_first ? second : first, second_child, segment_begin,
+                             shared_size);
+                details::copy_tail(second, second_child, shared_size);
+            }
+        }
+    };
+
+    template <std::size_t Points>
+    using k_point_crossover = basic_k_point_crossover<Points>;
+    using two_point_crossover = basic_k_point_crossover<2>;
+}  // namespace dp::genetic
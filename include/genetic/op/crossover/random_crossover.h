@@ -1,54 +1,71 @@
 #pragma once
 
+#include <cstddef>
 #include <ranges>
+#include <span>
 #include <type_traits>
+#include <utility>
 
+#include "genetic/bit_chromosome.h"
+#include "genetic/details/concepts.h"
 #include "genetic/details/crossover_helpers.h"
+#include "genetic/details/memory.h"
+#include "genetic/details/random_helpers.h"
 
 namespace dp::genetic {
     /**
      * @brief Randomly crosses over two parent ranges to produce a child range.
      * @details The pivot index (where the "splice" occurs) is randomly chosen using an
      * IndexProvider which defaults to a uniform integral generator. If the parents are empty,
-     * the child will be default constructed.
+     * the child will be empty.
+     * @tparam IndexProvider Generates the pivot indices.
      */
-    struct random_crossover {
-        template <std::ranges::range T, typename SimpleType = std::remove_cvref_t<T>,
-                  typename IndexProvider = genetic::uniform_integral_generator>
+    template <dp::genetic::concepts::index_generator IndexProvider =
+                  genetic::uniform_integral_generator>
+    struct basic_random_crossover {
+        template <std::ranges::range T, typename SimpleType = std::remove_cvref_t<T>>
             requires(std::is_default_constructible_v<SimpleType> ||
                      std::is_trivially_default_constructible_v<SimpleType>)
         auto operator()(T &&first, T &&second) {
+            // construct our children
+            SimpleType child = details::empty_like<SimpleType>(first);
+            (*this)(std::as_const(first), std::as_const(second), child);
+            return child;
+        }
+
+        /**
+         * @brief Writes the child of two parents into an existing chromosome.
+         * @details The child is cleared and refilled, so a child that already has enough
+         * capacity (i.e. the chromosome it replaces in the population) is not reallocated.
+         * @param first The first parent.
+         * @param second The second parent.
+         * @param child The output child, must not be one of the parents.
+         */
+        template <std::ranges::range T>
+            requires(std::is_default_constructible_v<T> ||
+                     std::is_trivially_default_constructible_v<T>)
+        void operator()(const T &first, const T &second, T &child) {
             const auto &first_size = std::ranges::distance(first);
             const auto &second_size = std::ranges::distance(second);
 
             if (first_size == 0 || second_size == 0) {
-                return SimpleType{};
+                clear(child);
+                return;
             }
 
-            static thread_local IndexProvider index_provider{};
+            IndexProvider index_provider{};
             const auto &first_pivot =
                 index_provider(static_cast<decltype(first_size)>(0), first_size);
             const auto &second_pivot =
                 index_provider(static_cast<decltype(second_size)>(0), second_size);
 
-            // construct our children
-            SimpleType child{};
-
             if constexpr (dp::genetic::type_traits::has_push_back<T>) {
-                // check for reserve() and empty() to try and save on allocations
+                // clear() keeps the capacity, so only a child that is too small reallocates
+                clear(child);
+                // check for reserve() to try and save on allocations
                 if constexpr (dp::genetic::type_traits::has_reserve<T>) {
-                    // calculate the child size
-                    auto child_size = details::calculate_crossover_output_size(
-                        first, second, first_pivot, second_pivot);
-
-                    // check for empty and if empty, reserve
-                    if constexpr (dp::genetic::type_traits::has_empty<T>) {
-                        if (child.empty()) child.reserve(child_size);
-
-                    } else {
-                        // blindly reserve to try and save on allocations
-                        child.reserve(child_size);
-                    }
+                    child.reserve(details::calculate_crossover_output_size(
+                        first, second, first_pivot, second_pivot));
                 }
                 // has push_back so we use a back inserter
                 details::cross(first, second, first_pivot, second_pivot, std::back_inserter(child));
@@ -56,8 +73,49 @@ namespace dp::genetic {
                 // otherwise, assume we can insert directly into the type
                 details::cross(first, second, first_pivot, second_pivot, std::ranges::begin(child));
             }
+        }
+
+        /**
+         * @brief Crosses over two bit chromosomes, copying up to a word at a time.
+         * @details Chromosomes of a fixed size are split at the same pivot, so the child has
+         * the same size as its parents.
+         * @param first The first parent.
+         * @param second The second parent.
+         * @param child The output child, must not be one of the parents.
+         */
+        template <std::size_t Bits>
+        void operator()(const bit_chromosome<Bits> &first, const bit_chromosome<Bits> &second,
+                        bit_chromosome<Bits> &child) {
+            IndexProvider index_provider{};
+            if constexpr (Bits != std::dynamic_extent) {
+                const auto pivot = index_provider(std::size_t{0}, Bits);
+                details::copy_bits(first.words(), 0, child.words(), 0, pivot);
+                details::copy_bits(second.words(), pivot, child.words(), pivot, Bits - pivot);
+            } else {
+                if (first.empty() || second.empty()) {
+                    child.resize(0);
+                    return;
+                }
+                const auto first_pivot = index_provider(std::size_t{0}, first.size());
+                const auto second_pivot = index_provider(std::size_t{0}, second.size());
+                const auto second_part = second.size() - second_pivot;
+                child.resize(first_pivot + second_part);
+                details::copy_bits(first.words(), 0, child.words(), 0, first_pivot);
+                details::copy_bits(second.words(), second_pivot, child.words(), first_pivot,
+                                   second_part);
+            }
+        }
 
-            return std::move(child);
+      private:
+        template <typename T>
+        static void clear(T &child) {
+            if constexpr (dp::genetic::type_traits::has_clear<T>) {
+                child.clear();
+            } else {
+                child = T{};
+            }
         }
     };
+
+    using random_crossover = basic_random_crossover<>;
 }  // namespace dp::genetic
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cmath>
+#include <random>
+#include <utility>
+
+#include "genetic/details/memory.h"
+#include "genetic/details/random_helpers.h"
+#include "genetic/op/crossover/blend_crossover.h"
+
+namespace dp::genetic {
+    /**
+     * @brief Simulated binary crossover (SBX) for real valued chromosomes.
+     * @details For every gene a spread factor beta is drawn such that the children are
+     * 0.5 * ((1 + beta) * a + (1 - beta) * b) and 0.5 * ((1 - beta) * a + (1 + beta) * b). The
+     * children keep the mean of the parents, and a larger distribution index keeps them closer
+     * to the parents. Both children come from the same random number.
+     * @tparam RandomDevice The random engine.
+     */
+    template <std::uniform_random_bit_generator RandomDevice = std::mt19937>
+    struct basic_simulated_binary_crossover {
+        /// @param distribution_index The distribution index eta, usually between 2 and 20.
+        explicit basic_simulated_binary_crossover(double distribution_index = 15.0)
+            : exponent_(1.0 / (distribution_index + 1.0)) {}
+
+        /**
+         * @brief Writes the child of two parents into an existing chromosome.
+         * @param first The first parent.
+         * @param second The second parent.
+         * @param child The output child, must not be one of the parents.
+         */
+        template <concepts::real_valued_chromosome T>
+        void operator()(const T &first, const T &second, T &child) const {
+            cross<false>(first, second, child, child);
+        }
+
+        /// @brief Writes both children of two parents.
+        template <concepts::real_valued_chromosome T>
+        void operator()(const T &first, const T &second, T &first_child, T &second_child) const {
+            cross<true>(first, second, first_child, second_child);
+        }
+
+        /// @brief Returns the child of two parents.
+        template <concepts::real_valued_chromosome T>
+            requires std::default_initializable<T>
+        [[nodiscard]] T operator()(const T &first, const T &second) const {
+            auto child = details::empty_like(first);
+            (*this)(first, second, child);
+            return child;
+        }
+
+      private:
+        template <bool BothChildren, typename T>
+        void cross(const T &first, const T &second, T &first_child, T &second_child) const {
+            using gene_type = std::ranges::range_value_t<T>;
+            auto &engine = details::thread_random_engine<RandomDevice>();
+            std::uniform_real_distribution<double> unit{};
+            details::blend_genes<BothChildren>(
+                first, second, first_child, second_child, [&](gene_type a, gene_type b) {
+                    const auto u = unit(engine);
+                    const auto beta = static_cast<gene_type>(
+                        u <= 0.5 ? std::pow(2.0 * u, exponent_)
+                                 : std::pow(1.0 / (2.0 * (1.0 - u)), exponent_));
+                    const auto sum = a + b;
+                    const auto spread = beta * (a - b);
+                    return std::pair{(sum + spread) / 2, (sum - spread) / 2};
+                });
+        }
+
+        double exponent_;
+    };
+
+    using simulated_binary_crossover = basic_simulated_binary_crossover<>;
+}  // namespace dp::genetic
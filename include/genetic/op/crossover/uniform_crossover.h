@@ -0,0 +1,158 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <ranges>
+#include <span>
+
+#include "genetic/bit_chromosome.h"
+#include "genetic/details/crossover_helpers.h"
+#include "genetic/details/memory.h"
+#include "genetic/details/random_helpers.h"
+
+namespace dp::genetic {
+    /**
+     * @brief Takes every gene of the child from either parent with equal probability.
+     * @details One random 64 bit word is a mask that picks 64 genes at once, and genes are
+     * selected without branches. Bit chromosomes are merged a word at a time. The child has the
+     * size of the first parent, genes that the second parent does not have are taken from the
+     * first parent. Both children of two parents are made in one pass with the same mask.
+     * @tparam RandomDevice The random engine that generates the masks.
+     */
+    template <std::uniform_random_bit_generator RandomDevice = std::mt19937>
+    struct basic_uniform_crossover {
+        /**
+         * @brief Writes the child of two parents into an existing chromosome.
+         * @param first The first parent.
+         * @param second The second parent.
+         * @param child The output child, must not be one of the parents.
+         */
+        template <std::ranges::random_access_range T>
+            requires std::ranges::sized_range<T> &&
+                     std::indirectly_writable<std::ranges::iterator_t<T>,
+                                              std::ranges::range_value_t<T>>
+        void operator()(const T &first, const T &second, T &child) const {
+            cross<false>(first, second, child, child);
+        }
+
+        /// @brief Writes both children of two parents, the second child takes the genes the
+        /// first child does not.
+        template <std::ranges::random_access_range T>
+            requires std::ranges::sized_range<T> &&
+                     std::indirectly_writable<std::ranges::iterator_t<T>,
+                                              std::ranges::range_value_t<T>>
+        void operator()(const T &first, const T &second, T &first_child, T &second_child) const {
+            cross<true>(first, second, first_child, second_child);
+        }
+
+        /// @brief Returns the child of two parents.
+        template <std::ranges::random_access_range T>
+            requires std::ranges::sized_range<T> && std::default_initializable<T>
+        [[nodiscard]] T operator()(const T &first, const T &second) const {
+            auto child = details::empty_like(first);
+            (*this)(first, second, child);
+            return child;
+        }
+
+        /// @brief Writes the child of two bit chromosomes, a word at a time.
+        template <std::size_t Bits>
+        void operator()(const bit_chromosome<Bits> &first, const bit_chromosome<Bits> &second,
+                        bit_chromosome<Bits> &child) const {
+            cross_bits<false>(first, second, child, child);
+        }
+
+        /// @brief Writes both children of two bit chromosomes, a word at a time.
+        template <std::size_t Bits>
+        void operator()(const bit_chromosome<Bits> &first, const bit_chromosome<Bits> &second,
+                        bit_chromosome<Bits> &first_child,
+                        bit_chromosome<Bits> &second_child) const {
+            cross_bits<true>(first, second, first_child, second_child);
+        }
+
+        /// @brief Returns the child of two bit chromosomes.
+        template <std::size_t Bits>
+        [[nodiscard]] bit_chromosome<Bits> operator()(const bit_chromosome<Bits> &first,
+                                                      const bit_chromosome<Bits> &second) const {
+            bit_chromosome<Bits> child{};
+            (*this)(first, second, child);
+            return child;
+        }
+
+      private:
+        template <bool BothChildren, typename T>
+        static void cross(const T &first, const T &second, T &first_child, T &second_child) {
+            const auto first_size = static_cast<std::size_t>(std::ranges::size(first));
+            const auto second_size = static_cast<std::size_t>(std::ranges::size(second));
+            details::resize_child(first_child, first_size);
+            if constexpr (BothChildren) details::resize_child(second_child, second_size);
+
+            auto &engine = details::thread_random_engine<RandomDevice>();
+            std::uniform_int_distribution<details::bit_word> random_word{};
+            const auto shared_size = std::min(first_size, second_size);
+            const auto first_genes = std::ranges::begin(first);
+            const auto second_genes = std::ranges::begin(second);
+            const auto first_child_genes = std::ranges::begin(first_child);
+            const auto second_child_genes = std::ranges::begin(second_child);
+            for (std::size_t block = 0; block < shared_size; block += details::bits_per_word) {
+                const auto mask = random_word(engine);
+                const auto block_end = std::min(block + details::bits_per_word, shared_size);
+                for (auto index = block; index < block_end; ++index) {
+                    const auto gene = static_cast<std::ranges::range_difference_t<T>>(index);
+                    const bool from_first = (mask >> (index - block)) & 1u;
+                    first_child_genes[gene] =
+                        from_first ? first_genes[gene] : second_genes[gene];
+                    if constexpr (BothChildren) {
+                        second_child_genes[gene] =
+                            from_first ? second_genes[gene] : first_genes[gene];
+                    }
+                }
+            }
+            details::copy_tail(first, first_child, shared_size);
+            if constexpr (BothChildren) details::copy_tail(second, second_child, shared_size);
+        }
+
+        template <bool BothChildren, std::size_t Bits>
+        static void cross_bits(const bit_chromosome<Bits> &first,
+                               const bit_chromosome<Bits> &second,
+                               bit_chromosome<Bits> &first_child,
+                               bit_chromosome<Bits> &second_child) {
+            if constexpr (Bits == std::dynamic_extent) {
+                first_child.resize(first.size());
+                if constexpr (BothChildren) second_child.resize(second.size());
+            }
+
+            auto &engine = details::thread_random_engine<RandomDevice>();
+            std::uniform_int_distribution<details::bit_word> random_word{};
+            const auto first_words = first.words();
+            const auto second_words = second.words();
+            const auto first_child_words = first_child.words();
+            const auto second_child_words = second_child.words();
+            const auto shared_size = std::min(first.size(), second.size());
+            const auto shared_words = details::bit_word_count(shared_size);
+            for (std::size_t word = 0; word < shared_words; ++word) {
+                // genes that only one parent has are always taken from that parent
+                const auto shared_bits = shared_size - word * details::bits_per_word;
+                const auto mask = random_word(engine) | ~details::low_bits_mask(shared_bits);
+                first_child_words[word] =
+                    (first_words[word] & mask) | (second_words[word] & ~mask);
+                if constexpr (BothChildren) {
+                    second_child_words[word] =
+                        (second_words[word] & mask) | (first_words[word] & ~mask);
+                }
+            }
+            std::ranges::copy(first_words.subspan(shared_words),
+                              first_child_words.begin() +
+                                  static_cast<std::ptrdiff_t>(shared_words));
+            if constexpr (BothChildren) {
+                std::ranges::copy(second_words.subspan(shared_words),
+                                  second_child_words.begin() +
+                                      static_cast<std::ptrdiff_t>(shared_words));
+            }
+        }
+    };
+
+    using uniform_crossover = basic_uniform_crossover<>;
+}  // namespace dp::genetic
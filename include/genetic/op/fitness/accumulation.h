@@ -1,18 +1,66 @@
 #pragma once
+#include <concepts>
 #include <numeric>
 #include <ranges>
+#include <span>
+#include <type_traits>
+
+#include "genetic/bit_chromosome.h"
+#include "genetic/details/kernels.h"
 
 namespace dp::genetic {
     namespace details {
         struct accumulation_fitness_op {
             template <std::ranges::range Range, typename ScoreType = double>
             constexpr ScoreType operator()(Range&& value) const {
-                return std::accumulate(std::ranges::begin(value), std::ranges::end(value),
-                                       ScoreType{});
+                if constexpr (type_traits::is_bit_chromosome<std::remove_cvref_t<Range>>) {
+                    // the sum of the bits is the number of set bits
+                    return static_cast<ScoreType>(value.count());
+                } else if constexpr (type_traits::contiguous_arithmetic_range<Range> &&
+                              std::is_arithmetic_v<ScoreType>) {
+                    // contiguous values are summed with independent partial sums
+                    using value_type = std::ranges::range_value_t<Range>;
+                    return details::sum<ScoreType>(std::span<const value_type>(
+                        std::ranges::data(value), std::ranges::size(value)));
+                } else {
+                    return std::accumulate(std::ranges::begin(value), std::ranges::end(value),
+                                           ScoreType{});
+                }
+            }
+        };
+
+        /**
+         * @brief Sums a range of values with compensated (Kahan-Babuska-Neumaier) summation.
+         * @details The rounding error of every addition is kept in a separate sum, so the error
+         * does not grow with the length of the range. Slower than a plain sum, use it for long
+         * real-valued chromosomes or values of very different magnitudes. Compilers must not
+         * reassociate floating point math (i.e. -ffast-math) for this to work.
+         */
+        struct compensated_accumulation_fitness_op {
+            template <std::ranges::range Range, std::floating_point ScoreType = double>
+            constexpr ScoreType operator()(Range&& value) const {
+                ScoreType sum{};
+                ScoreType compensation{};
+                for (const auto& element : value) {
+                    const auto addend = static_cast<ScoreType>(element);
+                    const auto next_sum = sum + addend;
+                    // the low order bits of the smaller value are lost in the addition
+                    const auto sum_magnitude = sum < ScoreType{} ? -sum : sum;
+                    const auto addend_magnitude = addend < ScoreType{} ? -addend : addend;
+                    compensation += sum_magnitude >= addend_magnitude
+                                        ? (sum - next_sum) + addend
+                                        : (addend - next_sum) + sum;
+                    sum = next_sum;
+                }
+                return sum + compensation;
             }
         };
     }  // namespace details
 
     /// @brief Fitness operator that accumulates the fitness of a range of values.
     inline constexpr auto accumulation_fitness = details::accumulation_fitness_op{};
+
+    /// @brief Fitness operator that accumulates a range of values with compensated summation.
+    inline constexpr auto compensated_accumulation_fitness =
+        details::compensated_accumulation_fitness_op{};
 }  // namespace dp::genetic
@@ -1,5 +1,13 @@
 #pragma once
 #include <functional>
+#include <future>
+#include <ranges>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "genetic/details/concepts.h"
+#include "genetic/execution.h"
 
 namespace dp::genetic {
 
@@ -17,10 +25,22 @@ namespace dp::genetic {
                                 std::make_index_sequence<TupSize>{});
         }
 
+        /// @brief Executors that can run every fitness operator on a range and return its result.
+        template <typename Executor, typename Range, typename... FitnessOperators>
+        concept fitness_executor =
+            (concepts::value_executor<Executor,
+                                      std::invoke_result_t<FitnessOperators&, const Range&>> &&
+             ...);
+
         /**
          * @brief A composite fitness function that allows you to chain together multiple fitness
          * functions with a custom binary operator to combine the results. By default, it uses
          * std::plus<>.
+         * @details Every fitness function makes its own pass over the chromosome, the passes are
+         * not fused into one. The fitness functions are opaque callables over the whole
+         * chromosome, and the library operators already use vectorised kernels (see
+         * details::sum and details::count_equal) that a shared element by element loop would
+         * lose.
          */
         template <typename... Args>
         struct composite_fitness {
@@ -36,24 +56,53 @@ namespace dp::genetic {
                       typename ScoreType = std::invoke_result_t<
                           std::decay_t<std::tuple_element_t<0, std::tuple<Args...>>>, Range>>
             ScoreType evaluate(const Range& data) {
-                // initialize the result to the first fitness function
-                ScoreType result = std::invoke(std::get<0>(fitness_ops_), data);
+                // the results are combined from left to right, the operators are not copied
+                return std::apply(
+                    [&data](auto& head, auto&... tail) {
+                        ScoreType result = std::invoke(head, data);
+                        ((result = std::invoke(BinaryOperator{}, result, std::invoke(tail, data))),
+                         ...);
+                        return result;
+                    },
+                    fitness_ops_);
+            }
 
-                // loop over the rest of them if there are more
-                if constexpr (sizeof...(Args) > 1) {
-                    auto rest_of_tuples = std::apply(
-                        [&](auto&& head, auto&&... tail) {
-                            // ignore the head and return tail
-                            return std::make_tuple(std::forward<decltype(tail)>(tail)...);
-                        },
-                        fitness_ops_);
-
-                    details::for_each_tuple(rest_of_tuples, [&](auto&& op) {
-                        // update result based on the previous result and the new score
-                        result = std::invoke(BinaryOperator{}, result, std::invoke(op, data));
-                    });
-                }
+            /**
+             * @brief Evaluates the fitness functions concurrently, for expensive fitness
+             * functions that do not depend on each other.
+             * @details The first fitness function runs on the calling thread and the others run
+             * on the executor. The results are combined in the same order as evaluate(). Do not
+             * use the executor that runs solve(), its tasks would wait on each other.
+             * @param executor Runs every fitness function except the first.
+             * @param data The chromosome, it must not change until this returns.
+             */
+            template <typename BinaryOperator, typename Executor, std::ranges::range Range,
+                      typename ScoreType = std::invoke_result_t<
+                          std::decay_t<std::tuple_element_t<0, std::tuple<Args...>>>, Range>>
+                requires fitness_executor<Executor, Range, Args...>
+            ScoreType evaluate(Executor& executor, const Range& data) {
+                return evaluate_on<BinaryOperator, ScoreType>(
+                    executor, data, std::make_index_sequence<sizeof...(Args) - 1>{});
+            }
+
+          private:
+            template <typename BinaryOperator, typename ScoreType, typename Executor,
+                      typename Range, std::size_t... Is>
+            ScoreType evaluate_on(Executor& executor, const Range& data,
+                                  std::index_sequence<Is...>) {
+                // the tasks refer to data, so every started task must finish before an exception
+                // leaves, even one thrown by a later enqueue()
+                std::tuple<std::future<std::invoke_result_t<
+                    std::tuple_element_t<Is + 1, std::tuple<Args...>>&, const Range&>>...>
+                    pending{};
+                task_wait_guard wait_for_tasks(pending);
+                ((std::get<Is>(pending) = executor.enqueue(
+                      [this, &data] { return std::invoke(std::get<Is + 1>(fitness_ops_), data); })),
+                 ...);
 
+                ScoreType result = std::invoke(std::get<0>(fitness_ops_), data);
+                ((result = std::invoke(BinaryOperator{}, result, std::get<Is>(pending).get())),
+                 ...);
                 return result;
             }
         };
@@ -87,6 +136,16 @@ namespace dp::genetic {
         ScoreType operator()(const Range& data) {
             return this->fitness_.template evaluate<std::plus<ScoreType>>(data);
         }
+
+        /// @brief Evaluates the fitness functions concurrently, see
+        /// details::composite_fitness::evaluate.
+        template <typename Executor, std::ranges::range Range,
+                  typename ScoreType = std::invoke_result_t<
+                      std::decay_t<std::tuple_element_t<0, std::tuple<Args...>>>, Range>>
+            requires details::fitness_executor<Executor, Range, Args...>
+        ScoreType operator()(Executor& executor, const Range& data) {
+            return this->fitness_.template evaluate<std::plus<ScoreType>>(executor, data);
+        }
     };
 
     /**
@@ -104,6 +163,16 @@ namespace dp::genetic {
         ScoreType operator()(const Range& data) {
             return this->fitness_.template evaluate<std::minus<ScoreType>>(data);
         }
+
+        /// @brief Evaluates the fitness functions concurrently, see
+        /// details::composite_fitness::evaluate.
+        template <typename Executor, std::ranges::range Range,
+                  typename ScoreType = std::invoke_result_t<
+                      std::decay_t<std::tuple_element_t<0, std::tuple<Args...>>>, Range>>
+            requires details::fitness_executor<Executor, Range, Args...>
+        ScoreType operator()(Executor& executor, const Range& data) {
+            return this->fitness_.template evaluate<std::minus<ScoreType>>(executor, data);
+        }
     };
 
     /**
@@ -121,6 +190,16 @@ namespace dp::genetic {
         ScoreType operator()(const Range& data) {
             return this->fitness_.template evaluate<std::multiplies<ScoreType>>(data);
         }
+
+        /// @brief Evaluates the fitness functions concurrently, see
+        /// details::composite_fitness::evaluate.
+        template <typename Executor, std::ranges::range Range,
+                  typename ScoreType = std::invoke_result_t<
+                      std::decay_t<std::tuple_element_t<0, std::tuple<Args...>>>, Range>>
+            requires details::fitness_executor<Executor, Range, Args...>
+        ScoreType operator()(Executor& executor, const Range& data) {
+            return this->fitness_.template evaluate<std::multiplies<ScoreType>>(executor, data);
+        }
     };
 
 }  // namespace dp::genetic
@@ -1,12 +1,19 @@
 #pragma once
+#include <algorithm>
 #include <concepts>
+#include <cstdlib>
 #include <ranges>
+#include <span>
+
+#include "genetic/bit_chromosome.h"
+#include "genetic/details/kernels.h"
 
 namespace dp::genetic {
 
     /**
      * @brief Fitness operator that compares two ranges element-wise.
-     * 
+     * @details Contiguous ranges of arithmetic values (i.e. std::string) are compared with
+     * details::count_equal and bit chromosomes with bit_chromosome::count_equal.
      * @tparam Range The chromosome std::range type
      * @tparam ScoreType
      */
@@ -18,11 +25,27 @@ namespace dp::genetic {
             ScoreType score{};
             const auto sol_length = std::ranges::distance(solution_);
             const auto val_length = std::ranges::distance(value);
-            std::ranges::range_difference_t<Range> index;
-            for (index = 0; index < std::min(sol_length, val_length); ++index) {
-                auto solution_val = solution_.at(index);
-                auto val = value.at(index);
-                if (val == solution_val) score += match_score_;
+            if constexpr (type_traits::is_bit_chromosome<Range>) {
+                // bit chromosomes compare 64 genes at a time with popcount
+                score += static_cast<ScoreType>(solution_.count_equal(value)) * match_score_;
+            } else if constexpr (type_traits::contiguous_arithmetic_range<const Range>) {
+                // contiguous chromosomes are compared without bounds checks or branches, see
+                // details::count_equal
+                using value_type = std::ranges::range_value_t<Range>;
+                const auto matches = details::count_equal(
+                    std::span<const value_type>(std::ranges::data(solution_),
+                                                std::ranges::size(solution_)),
+                    std::span<const value_type>(std::ranges::data(value),
+                                                std::ranges::size(value)));
+                score += static_cast<ScoreType>(matches) * match_score_;
+            } else {
+                auto solution_it = std::ranges::begin(solution_);
+                auto value_it = std::ranges::begin(value);
+                for (auto index = std::min(sol_length, val_length); index > 0; --index) {
+                    if (*value_it == *solution_it) score += match_score_;
+                    ++solution_it;
+                    ++value_it;
+                }
             }
 
             // subtract for difference in length
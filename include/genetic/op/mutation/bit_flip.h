@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <random>
+
+#include "genetic/bit_chromosome.h"
+#include "genetic/details/random_helpers.h"
+
+namespace dp::genetic {
+    /**
+     * @brief Flips every bit of a bit chromosome with the given probability.
+     * @details The gaps between flipped bits follow a geometric distribution, so one random
+     * number is drawn per flipped bit instead of one per bit.
+     * @tparam RandomDevice The random engine.
+     */
+    template <std::uniform_random_bit_generator RandomDevice = std::mt19937>
+    struct basic_bit_flip_mutator {
+        /// @param probability The probability that a bit is flipped.
+        explicit basic_bit_flip_mutator(double probability) : probability_(probability) {}
+
+        /// @brief Flips the bits in place.
+        template <std::size_t Bits>
+        void operator()(bit_chromosome<Bits> &chromosome) const {
+            if (probability_ <= 0.0 || chromosome.empty()) return;
+            if (probability_ >= 1.0) {
+                chromosome.flip();
+                return;
+            }
+
+            auto &engine = details::thread_random_engine<RandomDevice>();
+            // number of bits that are skipped before the next flip
+            std::geometric_distribution<std::size_t> gap(probability_);
+            const auto size = chromosome.size();
+            for (auto index = gap(engine); index < size;) {
+                chromosome.flip(index);
+                const auto skipped = gap(engine);
+                if (skipped >= size - index - 1) break;
+                index += skipped + 1;
+            }
+        }
+
+        /// @brief Returns a mutated copy of the chromosome.
+        template <std::size_t Bits>
+        [[nodiscard]] bit_chromosome<Bits> operator()(
+            const bit_chromosome<Bits> &chromosome) const {
+            auto mutated = chromosome;
+            (*this)(mutated);
+            return mutated;
+        }
+
+      private:
+        double probability_;
+    };
+
+    using bit_flip_mutator = basic_bit_flip_mutator<>;
+}  // namespace dp::genetic
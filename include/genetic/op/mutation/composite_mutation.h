@@ -1,9 +1,18 @@
 #pragma once
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "genetic/details/concepts.h"
+#include "genetic/details/memory.h"
 
 namespace dp::genetic {
     /**
      * @brief Composite mutator that chains together multiple mutation operators.
-     *
+     * @details The chromosome is mutated in place by every operator in turn. Operators that
+     * return a new value are given the chromosome as an rvalue and the result is moved back, so
+     * the chain never copies the chromosome.
      * @tparam Args The mutation operators to chain together.
      */
     template <typename... Args>
@@ -13,23 +22,39 @@ namespace dp::genetic {
       private:
         // list of mutators
         std::tuple<Args...> mutators_;
-        // https://stackoverflow.com/questions/75039429/chaining-callables-in-c
-        /// @brief Helper to help us chain mutator calls together
-        template <size_t index, class Arg>
-        decltype(auto) call_helper(Arg&& arg) {
-            if constexpr (index == 0) {
-                return std::forward<Arg>(arg);
+
+        /// @brief Applies a single mutator of the chain.
+        template <class Mutator, class T>
+        static void apply_mutator(Mutator& mutator, T& value) {
+            if constexpr (concepts::in_place_mutation_operator<Mutator&, T>) {
+                std::invoke(mutator, value);
             } else {
-                return std::get<index - 1>(mutators_)(
-                    call_helper<index - 1>(std::forward<Arg>(arg)));
+                value = std::invoke(mutator, std::move(value));
             }
         }
 
       public:
         explicit composite_mutator(Args&&... args) : mutators_(std::move(args)...) {}
+
+        template <typename T>
+            requires(!std::is_const_v<T>)
+        void operator()(T& value) {
+            std::apply([&value](auto&... mutators) { (apply_mutator(mutators, value), ...); },
+                       mutators_);
+        }
+
+        template <typename T>
+        [[nodiscard]] T operator()(const T& value) {
+            T result = details::copy_of(value);
+            (*this)(result);
+            return result;
+        }
+
         template <typename T>
-        T operator()(T t) {
-            return call_helper<sizeof...(Args)>(t);
+            requires(!std::is_lvalue_reference_v<T>)
+        [[nodiscard]] T operator()(T&& value) {
+            (*this)(value);
+            return std::move(value);
         }
     };
 }  // namespace dp::genetic
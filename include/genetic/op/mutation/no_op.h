@@ -1,13 +1,31 @@
 #pragma once
+#include <type_traits>
+#include <utility>
+
+#include "genetic/details/memory.h"
 
 namespace dp::genetic {
     /**
      * @brief No-op mutator, returns the value unchanged.
+     * @details solve() does not call it and keeps the fitness of the chromosome, see
+     * details::mutation_modifies_chromosome.
      */
     struct no_op_mutator {
+        static constexpr bool modifies_chromosome = false;
+
+        template <typename T>
+            requires(!std::is_const_v<T>)
+        constexpr void operator()(T&) const {}
+
         template <typename T>
         constexpr T operator()(const T& t) const {
-            return t;
+            return details::copy_of(t);
+        }
+
+        template <typename T>
+            requires(!std::is_lvalue_reference_v<T>)
+        constexpr T operator()(T&& t) const {
+            return std::move(t);
         }
     };
 }  // namespace dp::genetic
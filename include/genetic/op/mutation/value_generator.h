@@ -17,10 +17,9 @@ namespace dp::genetic {
     struct pooled_value_generator {
         pooled_value_generator(const T possible_values) : values_(std::move(possible_values)) {}
         [[nodiscard]] constexpr ValueType operator()() {
-            static IndexGenerator index_generator{};
             const auto output_index =
-                index_generator(static_cast<std::size_t>(0),
-                                static_cast<std::size_t>(std::ranges::size(values_) - 1));
+                index_generator_(static_cast<std::size_t>(0),
+                                 static_cast<std::size_t>(std::ranges::size(values_) - 1));
 
             auto location = std::ranges::begin(values_) + output_index;
             return *location;
@@ -28,5 +27,6 @@ namespace dp::genetic {
 
       private:
         T values_;
+        IndexGenerator index_generator_{};
     };
 }  // namespace dp::genetic
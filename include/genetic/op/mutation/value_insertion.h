@@ -2,8 +2,11 @@
 
 #include <functional>
 #include <ranges>
+#include <type_traits>
+#include <utility>
 
 #include "genetic/details/concepts.h"
+#include "genetic/details/memory.h"
 #include "genetic/op/mutation/value_generator.h"
 
 namespace dp::genetic {
@@ -25,25 +28,39 @@ namespace dp::genetic {
             : generator_(std::forward<ValueGenerator>(generator)),
               number_of_insertions_(number_of_insertions) {}
 
+        /// @brief Inserts the values in place.
         template <typename T>
-        [[nodiscard]] T operator()(const T& value) {
-            static IndexGenerator index_generator{};
-            T return_value = value;
-
+            requires(!std::is_const_v<T>)
+        void operator()(T& value) {
+            const auto original_size = static_cast<std::size_t>(std::ranges::size(value));
             for (std::size_t i = 0; i < number_of_insertions_; ++i) {
                 const auto output_index =
-                    index_generator(static_cast<std::size_t>(0),
-                                    static_cast<std::size_t>(std::ranges::size(value)) - 1);
-                auto location = std::ranges::begin(return_value) + output_index;
+                    index_generator_(static_cast<std::size_t>(0), original_size - 1);
+                auto location = std::ranges::begin(value) + output_index;
                 // todo: abstract the insertion logic
-                return_value.insert(location, std::invoke(generator_));
+                value.insert(location, std::invoke(generator_));
             }
+        }
 
+        /// @brief Returns a copy of the value with the new values inserted.
+        template <typename T>
+        [[nodiscard]] T operator()(const T& value) {
+            T return_value = details::copy_of(value);
+            (*this)(return_value);
             return return_value;
         }
 
+        /// @brief Inserts into an rvalue and returns it without copying it.
+        template <typename T>
+            requires(!std::is_lvalue_reference_v<T>)
+        [[nodiscard]] T operator()(T&& value) {
+            (*this)(value);
+            return std::move(value);
+        }
+
       private:
         std::function<ValueType()> generator_;
         std::uint_least64_t number_of_insertions_;
+        IndexGenerator index_generator_{};
     };
 }  // namespace dp::genetic
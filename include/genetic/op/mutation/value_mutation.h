@@ -1,70 +1,66 @@
 #pragma once
 #include <concepts>
+#include <random>
 #include <ranges>
+#include <type_traits>
+#include <utility>
 
 #include "genetic/details/concepts.h"
+#include "genetic/details/memory.h"
+#include "genetic/details/random_helpers.h"
 
 namespace dp::genetic {
     namespace details {
 
+        template <std::uniform_random_bit_generator RandomDevice = std::mt19937>
         struct number_generator_helper_op {
             template <typename Number>
             [[nodiscard]] constexpr Number operator()(Number lower, Number upper) const {
                 if constexpr (std::is_floating_point<Number>()) {
-                    static dp::genetic::uniform_floating_point_generator float_gen{};
-                    return float_gen(lower, upper);
+                    return dp::genetic::basic_uniform_floating_point_generator<RandomDevice>{}(
+                        lower, upper);
                 } else {
-                    static dp::genetic::uniform_integral_generator int_gen{};
-                    return int_gen(lower, upper);
+                    return dp::genetic::basic_uniform_integral_generator<RandomDevice>{}(lower,
+                                                                                         upper);
                 }
             }
         };
 
-        template <typename OutputRange>
-        struct range_converter_helper_op {
-            template <typename InputRange>
-                requires std::ranges::range<InputRange>
-            OutputRange operator()(const InputRange& input) {
-                // check for std::array and std::ranges::sized_range
-                if constexpr (std::ranges::sized_range<InputRange> &&
-                              dp::genetic::type_traits::is_std_array<OutputRange>) {
-                    OutputRange output{};
-                    for (auto i = 0; i < std::ranges::size(output); ++i) {
-                        output[i] = input[i];
-                    }
-                    return output;
+        template <std::uniform_random_bit_generator RandomDevice = std::mt19937>
+        constexpr inline auto number_generator = number_generator_helper_op<RandomDevice>{};
 
-                } else {
-                    // otherwise, just convert to the output range
-                    // note we have to wrap this in an "else" otherwise it won't compile due to it
-                    // being ill-formed for the "to" conversion
-                    return input | std::ranges::to<std::remove_cvref_t<OutputRange>>();
-                }
-            }
-        };
-
-        constexpr inline auto number_generator = number_generator_helper_op{};
-        template <typename Output>
-        using range_converter_helper = range_converter_helper_op<Output>;
-
-        template <dp::genetic::type_traits::number Number>
+        template <dp::genetic::type_traits::number Number,
+                  std::uniform_random_bit_generator RandomDevice = std::mt19937>
         struct value_mutation_op {
             Number lower_bound;
             Number upper_bound;
 
+            /// @brief Adds a random number to every value of the range, in place.
+            template <std::ranges::range T, typename ValueType = typename std::remove_cvref_t<
+                                                std::ranges::range_value_t<T>>>
+                requires(!std::is_const_v<T>) && type_traits::addable<ValueType, Number>
+            void operator()(T& t) const {
+                for (auto& value : t) {
+                    const auto offset = number_generator<RandomDevice>(lower_bound, upper_bound);
+                    value = static_cast<ValueType>(std::plus()(value, offset));
+                }
+            }
+
             template <std::ranges::range T, typename ValueType = typename std::remove_cvref_t<
                                                 std::ranges::range_value_t<T>>>
                 requires type_traits::addable<ValueType, Number>
             [[nodiscard]] T operator()(const T& t) const {
-                namespace vw = std::ranges::views;
-                auto result =
-                    t | vw::transform([low = lower_bound, up = upper_bound](const auto& value) {
-                        return static_cast<ValueType>(
-                            std::plus()(value, number_generator(low, up)));
-                    });
+                T result = details::copy_of(t);
+                (*this)(result);
+                return result;
+            }
 
-                auto converted_range = range_converter_helper<std::remove_cvref_t<T>>{}(result);
-                return std::move(converted_range);
+            template <std::ranges::range T, typename ValueType = typename std::remove_cvref_t<
+                                                std::ranges::range_value_t<T>>>
+                requires(!std::is_lvalue_reference_v<T>) && type_traits::addable<ValueType, Number>
+            [[nodiscard]] T operator()(T&& t) const {
+                (*this)(t);
+                return std::move(t);
             }
         };
     }  // namespace details
@@ -72,34 +68,39 @@ namespace dp::genetic {
     /**
      * @brief Mutates a range of values by adding a random number within the bounds.
      *
+     * @tparam RandomDevice The random engine used to generate the numbers.
      * @param lower_bound The lower bound of the random number.
      * @param upper_bound The upper bound of the random number.
      * @return The mutated value.
      */
+    template <std::uniform_random_bit_generator RandomDevice = std::mt19937>
     inline auto double_value_mutator(double lower_bound, double upper_bound) {
-        return details::value_mutation_op<double>{lower_bound, upper_bound};
+        return details::value_mutation_op<double, RandomDevice>{lower_bound, upper_bound};
     }
 
     /**
      * @brief Mutates a range of values by adding a random number within the bounds.
      *
+     * @tparam RandomDevice The random engine used to generate the numbers.
      * @param lower_bound The lower bound of the random number.
      * @param upper_bound The upper bound of the random number.
      * @return The mutated value.
      */
+    template <std::uniform_random_bit_generator RandomDevice = std::mt19937>
     inline auto float_value_mutator(float lower_bound, float upper_bound) {
-        return details::value_mutation_op<float>{lower_bound, upper_bound};
+        return details::value_mutation_op<float, RandomDevice>{lower_bound, upper_bound};
     }
 
     /**
      * @brief Mutates a range of values by adding a random number within the bounds.
      *
+     * @tparam RandomDevice The random engine used to generate the numbers.
      * @param lower_bound The lower bound of the random number.
      * @param upper_bound The upper bound of the random number.
      * @return The mutated value.
      */
-    template <std::integral Number>
+    template <std::integral Number, std::uniform_random_bit_generator RandomDevice = std::mt19937>
     constexpr inline auto integral_value_mutator(Number lower_bound, Number upper_bound) {
-        return details::value_mutation_op<Number>{lower_bound, upper_bound};
+        return details::value_mutation_op<Number, RandomDevice>{lower_bound, upper_bound};
     }
 }  // namespace dp::genetic
@@ -3,8 +3,11 @@
 #include <concepts>
 #include <cstdint>
 #include <ranges>
+#include <type_traits>
+#include <utility>
 
 #include "genetic/details/concepts.h"
+#include "genetic/details/memory.h"
 
 namespace dp::genetic {
 
@@ -28,28 +31,44 @@ namespace dp::genetic {
                                    std::uint_least64_t num_replacements = 1)
             : generator_(generator), number_of_replacements_(num_replacements) {}
 
+        /// @brief Replaces the values in place.
         template <typename T>
-        constexpr T operator()(const T& t) {
-            static IndexGenerator index_generator{};
-            auto return_value = t;
+            requires(!std::is_const_v<T>)
+        constexpr void operator()(T& t) {
             for (std::uint_least64_t _ :
                  std::views::iota(static_cast<std::uint_least64_t>(0), number_of_replacements_)) {
                 const auto output_index =
-                    index_generator(static_cast<std::size_t>(0),
-                                    static_cast<std::size_t>(std::ranges::size(t) - 1));
+                    index_generator_(static_cast<std::size_t>(0),
+                                     static_cast<std::size_t>(std::ranges::size(t) - 1));
 
-                auto location = std::ranges::begin(return_value) + output_index;
+                auto location = std::ranges::begin(t) + output_index;
                 auto value = std::invoke(generator_);
                 // ensure we don't replace the value with the same value
                 while (value == *location) value = std::invoke(generator_);
                 std::swap(*location, value);
             }
+        }
+
+        /// @brief Returns a mutated copy of the value.
+        template <typename T>
+        [[nodiscard]] constexpr T operator()(const T& t) {
+            T return_value = details::copy_of(t);
+            (*this)(return_value);
             return return_value;
         }
 
+        /// @brief Mutates and returns an rvalue without copying it.
+        template <typename T>
+            requires(!std::is_lvalue_reference_v<T>)
+        [[nodiscard]] constexpr T operator()(T&& t) {
+            (*this)(t);
+            return std::move(t);
+        }
+
       private:
         ValueGenerator generator_;
         std::uint_least64_t number_of_replacements_;
+        IndexGenerator index_generator_{};
     };
 
 }  // namespace dp::genetic
@@ -1,31 +1,82 @@
 #pragma once
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <random>
 #include <ranges>
+#include <vector>
 
 #include "genetic/details/concepts.h"
 #include "genetic/op/selection/roulette_selection.h"
 
 namespace dp::genetic {
+    namespace details {
+        /**
+         * @brief Computes the rank weight of each individual from its fitness.
+         * @details The best individual gets a weight of N and the worst a weight of 1. Ties keep
+         * their order in the population, so earlier individuals rank higher. Only the fitness
+         * values are sorted (by index), the chromosomes are never compared or moved.
+         * @param fitness The fitness of each individual, in population order.
+         * @return The rank weight of each individual, in population order.
+         */
+        inline std::vector<double> rank_weights(const std::vector<double>& fitness) {
+            const auto size = fitness.size();
+            std::vector<std::size_t> order(size);
+            std::iota(order.begin(), order.end(), std::size_t{0});
+
+            const auto better = [&fitness](std::size_t first, std::size_t second) {
+                return fitness[first] > fitness[second];
+            };
+            std::ranges::stable_sort(order, better);
+
+            std::vector<double> weights(size);
+            for (std::size_t position = 0; position < size; ++position) {
+                weights[order[position]] = static_cast<double>(size - position);
+            }
+            return weights;
+        }
+    }  // namespace details
+
     /**
      * @brief Perform rank selection on a population.
+     * @details Individuals are selected with a probability proportional to their rank, where the
+     * best individual has the highest rank.
+     * @tparam RandomDevice The random engine used for the draws.
      */
-    struct rank_selection {
-        template <std::ranges::range Range, typename UnaryOperator,
-                  typename T = std::ranges::range_value_t<Range>,
-                  typename FitnessResult = std::invoke_result_t<UnaryOperator, T>>
-        std::pair<T, T> operator()(Range population, UnaryOperator fitness_op) {
-            // assume population is sorted already
-            auto reverse_view = population | std::views::reverse;
-
-            // fitness evaluator/operator
-            auto rank_fitness_op = [&](const T& value) -> FitnessResult {
-                auto location = std::find(reverse_view.begin(), reverse_view.end(), value);
-                return static_cast<FitnessResult>(
-                    static_cast<double>(std::distance(reverse_view.begin(), location)) + 1.0);
-            };
+    template <std::uniform_random_bit_generator RandomDevice = std::mt19937>
+    struct basic_rank_selection {
+        template <std::ranges::forward_range Range, typename UnaryOperator,
+                  typename T = std::ranges::range_value_t<Range>>
+        std::pair<T, T> operator()(Range&& population, UnaryOperator fitness_op) {
+            const auto sampler = prepare(population, fitness_op);
+            const auto [first, second] = sampler();
+            const auto begin = std::ranges::begin(population);
+            return {*std::ranges::next(begin, static_cast<std::ptrdiff_t>(first)),
+                    *std::ranges::next(begin, static_cast<std::ptrdiff_t>(second))};
+        }
 
-            roulette_selection selection{};
-            // use roulette selection for the rest
-            return selection(reverse_view, rank_fitness_op);
+        /**
+         * @brief Builds the rank weight table for the whole population once.
+         * @details Fitness is evaluated once per individual and every draw is a binary search
+         * over the cumulative rank weights.
+         * @param population The population to select from.
+         * @param fitness_op The fitness operator.
+         * @return A sampler that returns the indices of two parents in the population.
+         */
+        template <std::ranges::forward_range Range, typename UnaryOperator>
+        [[nodiscard]] details::cumulative_weight_sampler<RandomDevice> prepare(
+            Range&& population, UnaryOperator fitness_op) const {
+            std::vector<double> fitness;
+            if constexpr (std::ranges::sized_range<Range>) {
+                fitness.reserve(std::ranges::size(population));
+            }
+            for (const auto& value : population) {
+                fitness.push_back(static_cast<double>(fitness_op(value)));
+            }
+            return details::cumulative_weight_sampler<RandomDevice>{
+                details::rank_weights(fitness)};
         }
     };
-}  // namespace dp::genetic
\ No newline at end of file
+
+    using rank_selection = basic_rank_selection<>;
+}  // namespace dp::genetic
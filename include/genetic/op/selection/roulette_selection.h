@@ -1,19 +1,72 @@
 #pragma once
 #include <algorithm>
+#include <numeric>
+#include <random>
 #include <ranges>
+#include <utility>
+#include <vector>
 
 #include "genetic/details/concepts.h"
 #include "genetic/details/random_helpers.h"
 
 namespace dp::genetic {
+    namespace details {
+        /**
+         * @brief Draws parent indices from a table of cumulative weights.
+         * @details The table is built once and each draw is a binary search, so drawing parents
+         * costs O(log N) instead of O(N). The sampler is immutable after construction, so it can
+         * be shared by multiple threads.
+         * @tparam RandomDevice The random engine used for the draws.
+         */
+        template <std::uniform_random_bit_generator RandomDevice = std::mt19937>
+        class cumulative_weight_sampler {
+          public:
+            template <std::ranges::input_range Weights>
+            explicit cumulative_weight_sampler(Weights&& weights) {
+                if constexpr (std::ranges::sized_range<Weights>) {
+                    cumulative_weights_.reserve(std::ranges::size(weights));
+                }
+                double sum{};
+                double running_max{};
+                for (const auto& weight : weights) {
+                    sum += static_cast<double>(weight);
+                    // the running maximum keeps the table sorted even when there are negative
+                    // weights, and finds the same first index a linear walk would find
+                    running_max = cumulative_weights_.empty() ? sum : std::max(running_max, sum);
+                    cumulative_weights_.push_back(running_max);
+                }
+                sum_ = sum;
+            }
+
+            [[nodiscard]] std::pair<std::size_t, std::size_t> operator()() const {
+                constexpr auto generator = basic_uniform_floating_point_generator<RandomDevice>{};
+                return {find(generator(0.0, 1.0) * sum_), find(generator(0.0, 1.0) * sum_)};
+            }
+
+          private:
+            [[nodiscard]] std::size_t find(double threshold) const {
+                const auto location = std::ranges::lower_bound(cumulative_weights_, threshold);
+                // guard against the threshold being beyond the table due to rounding
+                if (location == cumulative_weights_.end()) return cumulative_weights_.size() - 1;
+                return static_cast<std::size_t>(
+                    std::ranges::distance(cumulative_weights_.begin(), location));
+            }
+
+            std::vector<double> cumulative_weights_;
+            double sum_{};
+        };
+    }  // namespace details
+
     /**
      * @brief Perform roulette selection on a population.
+     * @tparam RandomDevice The random engine used for the draws.
      */
-    struct roulette_selection {
+    template <std::uniform_random_bit_generator RandomDevice = std::mt19937>
+    struct basic_roulette_selection {
         template <std::ranges::range Range, typename UnaryOperator,
                   typename T = std::ranges::range_value_t<Range>,
                   typename FitnessResult = std::invoke_result_t<UnaryOperator, T>>
-        std::pair<T, T> operator()(Range population, UnaryOperator fitness_op) {
+        std::pair<T, T> operator()(Range&& population, UnaryOperator fitness_op) {
             // convert our data to work with std::accumulate
             auto data = population | std::views::common;
             // generate sum
@@ -22,7 +75,7 @@ namespace dp::genetic {
                                                     return current_sum + fitness_op(value);
                                                 });
 
-            thread_local auto generator = uniform_floating_point_generator{};
+            constexpr auto generator = basic_uniform_floating_point_generator<RandomDevice>{};
             auto first_value = generator(0.0, 1.0);
             auto second_value = generator(0.0, 1.0);
 
@@ -51,5 +104,23 @@ namespace dp::genetic {
             // pick 2 parents and return them
             return return_pair;
         }
+
+        /**
+         * @brief Builds a cumulative fitness table for the whole population once.
+         * @details Use this when drawing many pairs from the same population (i.e. a whole
+         * generation). Fitness is evaluated once per individual and every draw is a binary search.
+         * @param population The population to select from.
+         * @param fitness_op The fitness operator.
+         * @return A sampler that returns the indices of two parents in the population.
+         */
+        template <std::ranges::random_access_range Range, typename UnaryOperator>
+            requires std::ranges::sized_range<Range>
+        [[nodiscard]] details::cumulative_weight_sampler<RandomDevice> prepare(
+            Range&& population, UnaryOperator fitness_op) const {
+            return details::cumulative_weight_sampler<RandomDevice>{
+                population | std::views::transform(fitness_op)};
+        }
     };
+
+    using roulette_selection = basic_roulette_selection<>;
 }  // namespace dp::genetic
@@ -0,0 +1,99 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <random>
+#include <ranges>
+#include <utility>
+
+#include "genetic/details/concepts.h"
+#include "genetic/details/random_helpers.h"
+
+namespace dp::genetic {
+    namespace details {
+        /**
+         * @brief Draws parent indices by running tournaments over a population.
+         * @details Holds a view of the population, so it must not outlive it. Drawing does not
+         * modify the sampler, so it can be shared by multiple threads.
+         */
+        template <std::ranges::view Population, typename UnaryOperator,
+                  std::uniform_random_bit_generator RandomDevice = std::mt19937>
+        class tournament_sampler {
+          public:
+            tournament_sampler(Population population, UnaryOperator fitness_op,
+                               std::size_t tournament_size)
+                : population_(std::move(population)),
+                  fitness_op_(std::move(fitness_op)),
+                  tournament_size_(std::max<std::size_t>(tournament_size, 1)) {}
+
+            [[nodiscard]] std::pair<std::size_t, std::size_t> operator()() const {
+                return {run_tournament(), run_tournament()};
+            }
+
+          private:
+            [[nodiscard]] std::size_t run_tournament() const {
+                constexpr auto generator = basic_uniform_integral_generator<RandomDevice>{};
+                const auto last = static_cast<std::size_t>(std::ranges::size(population_)) - 1;
+
+                auto best_index = generator(std::size_t{0}, last);
+                auto best_fitness = fitness_op_(population_[best_index]);
+                for (std::size_t round = 1; round < tournament_size_; ++round) {
+                    const auto index = generator(std::size_t{0}, last);
+                    const auto fitness = fitness_op_(population_[index]);
+                    if (fitness > best_fitness) {
+                        best_index = index;
+                        best_fitness = fitness;
+                    }
+                }
+                return best_index;
+            }
+
+            Population population_;
+            // fitness operators are not required to be const callable
+            mutable UnaryOperator fitness_op_;
+            std::size_t tournament_size_;
+        };
+    }  // namespace details
+
+    /**
+     * @brief Perform tournament selection on a population.
+     * @details Each parent is the fittest of `tournament_size` individuals picked uniformly at
+     * random (with replacement). A draw costs O(tournament_size) and needs no information about
+     * the rest of the population, so it scales to any population size. Larger tournaments
+     * increase the selection pressure.
+     * @tparam RandomDevice The random engine used for the draws.
+     */
+    template <std::uniform_random_bit_generator RandomDevice = std::mt19937>
+    struct basic_tournament_selection {
+        std::size_t tournament_size{2};
+        explicit basic_tournament_selection(std::size_t size = 2) : tournament_size(size) {}
+
+        template <std::ranges::random_access_range Range, typename UnaryOperator,
+                  typename T = std::ranges::range_value_t<Range>>
+            requires std::ranges::sized_range<Range>
+        std::pair<T, T> operator()(Range&& population, UnaryOperator fitness_op) const {
+            const auto [first, second] = prepare(population, fitness_op)();
+            return {std::ranges::begin(population)[first],
+                    std::ranges::begin(population)[second]};
+        }
+
+        /**
+         * @brief Prepares a sampler that runs tournaments over the population.
+         * @details There is no per generation work to do, the sampler only keeps a view of the
+         * population and the fitness operator.
+         * @param population The population to select from.
+         * @param fitness_op The fitness operator.
+         * @return A sampler that returns the indices of two parents in the population.
+         */
+        template <std::ranges::random_access_range Range, typename UnaryOperator>
+            requires std::ranges::sized_range<Range> && std::ranges::viewable_range<Range>
+        [[nodiscard]] auto prepare(Range&& population, UnaryOperator fitness_op) const {
+            return details::tournament_sampler<std::views::all_t<Range>, UnaryOperator,
+                                               RandomDevice>{
+                std::views::all(std::forward<Range>(population)), std::move(fitness_op),
+                tournament_size};
+        }
+    };
+
+    using tournament_selection = basic_tournament_selection<>;
+}  // namespace dp::genetic
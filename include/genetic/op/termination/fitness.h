@@ -6,7 +6,7 @@ namespace dp::genetic {
         struct fitness_termination_criteria_op {
             double target_fitness{};
             template <typename T>
-            bool operator()(T, double fitness) {
+            bool operator()(const T&, double fitness) {
                 return fitness >= target_fitness;
             }
         };
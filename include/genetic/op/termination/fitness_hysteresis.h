@@ -17,7 +17,7 @@ namespace dp::genetic {
                 : fitness_variation_threshold(fitness_threshold),
                   max_generations_between_changes(max_generations_between) {}
             template <typename T>
-            [[nodiscard]] constexpr bool operator()(T, double fitness) {
+            [[nodiscard]] constexpr bool operator()(const T&, double fitness) {
                 if (std::abs(previous_fitness_ - fitness) > fitness_variation_threshold) {
                     // significant change in fitness
                     previous_fitness_ = fitness;
@@ -9,7 +9,7 @@ namespace dp::genetic {
             explicit generations_termination_op(std::uint_least64_t max_gens = 1000)
                 : max_generations(max_gens), count_(max_gens) {}
             template <typename T>
-            [[nodiscard]] constexpr bool operator()(T, double) {
+            [[nodiscard]] constexpr bool operator()(const T&, double) {
                 count_--;
                 return count_ == 0;
             }
@@ -2,6 +2,9 @@
 
 #include <functional>
 #include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
 
 #include "crossover.h"
 #include "details/concepts.h"
@@ -11,6 +14,107 @@
 #include "termination.h"
 
 namespace dp::genetic {
+    namespace details {
+        /**
+         * @brief Creates a parent selector that draws pairs of parents from a scored population.
+         * @details The selector is created once per generation. Operators that support
+         * preparation build their tables once for the whole generation. Operators that are
+         * generic over the population element type are run directly over the (chromosome,
+         * fitness) pairs using the cached fitness. Operators that only accept a population of
+         * chromosomes are given a copy of the chromosomes and the fitness operator, which means
+         * they re-evaluate fitness. The selector references the population and the fitness
+         * operator, so it must not outlive them. solve() shares one selector between all the
+         * tasks of a generation, so it calls the selection operator concurrently.
+         *
+         * The selector is called with a buffer and returns references to the two scored parents,
+         * so callers can reuse the fitness of a parent that is passed on unchanged. Prepared
+         * operators return references into the population, so the parents are never copied.
+         * Other operators return the parents by value, those are moved into the buffer. The
+         * references are valid until the buffer is used again.
+         * @tparam PopulationType The population type the selection operator accepts.
+         * @param op The selection operator.
+         * @param population The scored population of the generation.
+         * @param fitness The fitness operator.
+         * @return A callable that takes a std::pair<Scored, Scored>& buffer and returns a pair of
+         * references to the (chromosome, fitness) pairs of the parents.
+         */
+        template <typename PopulationType, typename SelectionOperator, typename ScoredPopulation,
+                  typename FitnessOperator>
+        auto make_parent_selector(const SelectionOperator& op, const ScoredPopulation& population,
+                                  const FitnessOperator& fitness) {
+            using scored_view = std::ranges::ref_view<const ScoredPopulation>;
+            using scored_chromosome = std::ranges::range_value_t<ScoredPopulation>;
+            using parent_buffer = std::pair<scored_chromosome, scored_chromosome>;
+            using parents = std::pair<const scored_chromosome&, const scored_chromosome&>;
+            if constexpr (concepts::prepared_selection_operator<SelectionOperator, scored_view,
+                                                                details::cached_fitness_op>) {
+                return [sampler = dp::genetic::prepare_selection(op, population),
+                        &population](parent_buffer&) -> parents {
+                    const auto [first, second] = std::invoke(sampler);
+                    return {population[first], population[second]};
+                };
+            } else if constexpr (concepts::selection_operator<SelectionOperator, scored_chromosome,
+                                                              scored_view,
+                                                              details::cached_fitness_op>) {
+                return [op, &population](parent_buffer& buffer) mutable -> parents {
+                    // the scored pairs are kept, so their fitness comes along with them
+                    auto [first, second] =
+                        std::invoke(op, std::views::all(population), dp::genetic::cached_fitness);
+                    buffer.first = std::move(first);
+                    buffer.second = std::move(second);
+                    return {buffer.first, buffer.second};
+                };
+            } else {
+                return [op, &fitness,
+                        chromosomes = population | std::views::elements<0> |
+                                      std::ranges::to<PopulationType>()](
+                           parent_buffer& buffer) mutable -> parents {
+                    auto [first, second] = dp::genetic::select_parents(op, chromosomes, fitness);
+                    buffer.first.first = std::move(first);
+                    buffer.first.second =
+                        dp::genetic::evaluate_fitness(fitness, buffer.first.first);
+                    buffer.second.first = std::move(second);
+                    buffer.second.second =
+                        dp::genetic::evaluate_fitness(fitness, buffer.second.first);
+                    return {buffer.first, buffer.second};
+                };
+            }
+        }
+
+        /**
+         * @brief Whether a selection operator needs the population to be sorted by fitness.
+         * @details solve() only sorts the population (lowest fitness first) when the selection
+         * operator needs it. Operators ask for it with a `static constexpr bool
+         * requires_sorted_population` member; the built-in operators do not need it. Operators
+         * that only accept a population of chromosomes are assumed to need it, because the
+         * population used to always be sorted.
+         * @tparam PopulationType The population type the selection operator accepts.
+         * @tparam SelectionOperator The selection operator.
+         * @tparam ScoredPopulation The scored population type of solve().
+         */
+        template <typename PopulationType, typename SelectionOperator, typename ScoredPopulation>
+        [[nodiscard]] constexpr bool requires_sorted_population() {
+            using scored_view = std::ranges::ref_view<const ScoredPopulation>;
+            using scored_chromosome = std::ranges::range_value_t<ScoredPopulation>;
+            if constexpr (requires { SelectionOperator::requires_sorted_population; }) {
+                return SelectionOperator::requires_sorted_population;
+            } else {
+                return !concepts::prepared_selection_operator<SelectionOperator, scored_view,
+                                                              details::cached_fitness_op> &&
+                       !concepts::selection_operator<SelectionOperator, scored_chromosome,
+                                                     scored_view, details::cached_fitness_op>;
+            }
+        }
+    }  // namespace details
+
+    /**
+     * @brief Algorithm parameters with type erased operators.
+     * @details solve() shares one params object between all its worker tasks, so the operators
+     * are called concurrently and must be safe to do so when solve() runs on more than one
+     * thread.
+     * @tparam ChromosomeType The chromosome type.
+     * @tparam PopulationType The population type.
+     */
     template <typename ChromosomeType, typename PopulationType = std::vector<ChromosomeType>>
         requires dp::genetic::concepts::population<PopulationType, ChromosomeType>
     class params {
@@ -19,13 +123,26 @@ namespace dp::genetic {
         /// @{
         using value_type = ChromosomeType;
         using population_type = PopulationType;
+        // the mutation operator takes the chromosome by value so that callers can move it in
         using mutation_operator_type = std::function<ChromosomeType(ChromosomeType)>;
+        // the crossover operator writes the child into an existing chromosome so that solve()
+        // can reuse its storage
         using crossover_operator_type =
-            std::function<ChromosomeType(ChromosomeType, ChromosomeType)>;
-        using fitness_evaluation_type = std::function<double(ChromosomeType)>;
-        using termination_evaluation_type = std::function<bool(ChromosomeType, double)>;
-        using selection_operator_type = std::function<std::pair<ChromosomeType, ChromosomeType>(
-            PopulationType, fitness_evaluation_type)>;
+            std::function<void(const ChromosomeType&, const ChromosomeType&, ChromosomeType&)>;
+        using crossover_pair_operator_type = std::function<void(
+            const ChromosomeType&, const ChromosomeType&, ChromosomeType&, ChromosomeType&)>;
+        using fitness_evaluation_type = std::function<double(const ChromosomeType&)>;
+        using batch_fitness_evaluation_type =
+            std::function<void(std::span<const ChromosomeType>, std::span<double>)>;
+        using termination_evaluation_type = std::function<bool(const ChromosomeType&, double)>;
+        using scored_chromosome_type = std::pair<ChromosomeType, double>;
+        using scored_population_type = std::vector<scored_chromosome_type>;
+        using parent_buffer_type = std::pair<scored_chromosome_type, scored_chromosome_type>;
+        using parent_selector_type =
+            std::function<std::pair<const scored_chromosome_type&, const scored_chromosome_type&>(
+                parent_buffer_type&)>;
+        using selection_operator_type = std::function<parent_selector_type(
+            const scored_population_type&, const fitness_evaluation_type&)>;
         /// @}
 
         template <class FitnessOperator = details::accumulation_fitness_op,
@@ -33,9 +150,9 @@ namespace dp::genetic {
                   class CrossoverOperator = random_crossover,
                   class TerminationOperator = generations_termination,
                   class SelectionOperator = roulette_selection>
-            requires concepts::mutation_operator<MutationOperator, ChromosomeType> &&
+            requires concepts::any_mutation_operator<MutationOperator, ChromosomeType> &&
                          concepts::fitness_operator<FitnessOperator, ChromosomeType> &&
-                         concepts::crossover_operator<CrossoverOperator, ChromosomeType> &&
+                         concepts::any_crossover_operator<CrossoverOperator, ChromosomeType> &&
                          concepts::termination_operator<
                              TerminationOperator, ChromosomeType,
                              std::invoke_result_t<FitnessOperator, ChromosomeType>> &&
@@ -46,31 +163,72 @@ namespace dp::genetic {
                         TerminationOperator&& terminator = TerminationOperator{},
                         CrossoverOperator&& crosser = CrossoverOperator{},
                         SelectionOperator selection_operator = SelectionOperator{})
-            : mutator_(std::forward<MutationOperator>(mutator)),
-              crossover_(std::forward<CrossoverOperator>(crosser)),
+            : mutator_(make_mutation_operator(std::forward<MutationOperator>(mutator))),
+              crossover_pair_(make_crossover_pair_operator(crosser)),
+              crossover_(make_crossover_operator(std::forward<CrossoverOperator>(crosser))),
               fitness_(std::forward<FitnessOperator>(fitness)),
               termination_(std::forward<TerminationOperator>(terminator)),
-              selection_(std::forward<SelectionOperator>(selection_operator)) {}
+              selection_(make_selection_operator(std::move(selection_operator))),
+              mutation_modifies_(details::mutation_modifies_chromosome<MutationOperator>()),
+              sorted_population_(
+                  details::requires_sorted_population<PopulationType, SelectionOperator,
+                                                      scored_population_type>()) {}
 
         [[nodiscard]] auto&& fitness_operator() const { return fitness_; }
         [[nodiscard]] auto&& mutation_operator() const { return mutator_; }
         [[nodiscard]] auto&& crossover_operator() const { return crossover_; }
         [[nodiscard]] auto&& termination_operator() const { return termination_; }
         [[nodiscard]] auto&& selection_operator() const { return selection_; }
+
+        /// @brief Whether the fitness operator scores batches of chromosomes, see
+        /// concepts::batch_fitness_operator.
+        [[nodiscard]] bool has_batch_fitness() const { return static_cast<bool>(batch_fitness_); }
+        /// @brief The batch fitness operator, empty if has_batch_fitness() is false.
+        [[nodiscard]] auto&& batch_fitness_operator() const { return batch_fitness_; }
+
+        /// @brief Whether the crossover operator makes both children of two parents in one
+        /// call, see concepts::crossover_pair_operator.
+        [[nodiscard]] bool has_pair_crossover() const { return static_cast<bool>(crossover_pair_); }
+        /// @brief The pair crossover operator, empty if has_pair_crossover() is false.
+        [[nodiscard]] auto&& crossover_pair_operator() const { return crossover_pair_; }
+
+        /// @brief Whether the selection operator needs the population sorted by fitness, see
+        /// details::requires_sorted_population.
+        [[nodiscard]] bool requires_sorted_population() const { return sorted_population_; }
+
+        /// @brief Whether the mutation operator can change a chromosome, see
+        /// details::mutation_modifies_chromosome.
+        [[nodiscard]] bool mutation_modifies_chromosome() const { return mutation_modifies_; }
+
+        /// @brief Creates the parent selector for one generation, see
+        /// details::make_parent_selector.
+        [[nodiscard]] parent_selector_type parent_selector(
+            const scored_population_type& population) const {
+            return selection_(population, fitness_);
+        }
+
         /// @brief builder class that helps with parameter construction
         class builder {
           public:
             builder() = default;
 
+            /// @brief Sets the fitness operator, batch fitness operators are also used to score
+            /// single chromosomes.
             builder& with_fitness_operator(
-                dp::genetic::concepts::fitness_operator<ChromosomeType> auto&& op) {
-                data_.fitness_ = op;
+                dp::genetic::concepts::any_fitness_operator<ChromosomeType> auto&& op) {
+                if constexpr (concepts::batch_fitness_operator<decltype(op), ChromosomeType>) {
+                    data_.batch_fitness_ = op;
+                } else {
+                    data_.batch_fitness_ = nullptr;
+                }
+                data_.fitness_ = details::make_single_fitness<ChromosomeType>(op);
                 return *this;
             }
 
             builder& with_mutation_operator(
-                dp::genetic::concepts::mutation_operator<ChromosomeType> auto&& op) {
-                data_.mutator_ = op;
+                dp::genetic::concepts::any_mutation_operator<ChromosomeType> auto&& op) {
+                data_.mutation_modifies_ = details::mutation_modifies_chromosome<decltype(op)>();
+                data_.mutator_ = make_mutation_operator(std::forward<decltype(op)>(op));
                 return *this;
             }
 
@@ -82,15 +240,18 @@ namespace dp::genetic {
             }
 
             builder& with_crossover_operator(
-                dp::genetic::concepts::crossover_operator<ChromosomeType> auto&& op) {
-                data_.crossover_ = std::forward<decltype(op)>(op);
+                dp::genetic::concepts::any_crossover_operator<ChromosomeType> auto&& op) {
+                data_.crossover_pair_ = make_crossover_pair_operator(op);
+                data_.crossover_ = make_crossover_operator(std::forward<decltype(op)>(op));
                 return *this;
             }
 
             template <typename UnaryOp>
             builder& with_selection_operator(dp::genetic::concepts::selection_operator<
                                              ChromosomeType, PopulationType, UnaryOp> auto&& op) {
-                data_.selection_ = std::forward<decltype(op)>(op);
+                data_.sorted_population_ = details::requires_sorted_population<
+                    PopulationType, std::remove_cvref_t<decltype(op)>, scored_population_type>();
+                data_.selection_ = make_selection_operator(std::forward<decltype(op)>(op));
                 return *this;
             }
 
@@ -103,10 +264,244 @@ namespace dp::genetic {
       private:
         friend class builder;
 
+        /**
+         * @brief Wraps an in place mutation operator so it can be stored as a
+         * mutation_operator_type. The chromosome is moved in and out of the wrapper, so no copies
+         * are made.
+         */
+        template <typename MutationOperator>
+        static mutation_operator_type make_mutation_operator(MutationOperator&& op) {
+            using simple_type = std::remove_cvref_t<MutationOperator>;
+            if constexpr (concepts::mutation_operator<simple_type, ChromosomeType>) {
+                return std::forward<MutationOperator>(op);
+            } else {
+                return [op = std::forward<MutationOperator>(op)](ChromosomeType value) mutable {
+                    std::invoke(op, value);
+                    return value;
+                };
+            }
+        }
+
+        /**
+         * @brief Wraps a crossover operator that returns the child so it can be stored as a
+         * crossover_operator_type. The returned child is moved into the output chromosome.
+         */
+        template <typename CrossoverOperator>
+        static crossover_operator_type make_crossover_operator(CrossoverOperator&& op) {
+            using simple_type = std::remove_cvref_t<CrossoverOperator>;
+            if constexpr (concepts::crossover_into_operator<simple_type, ChromosomeType>) {
+                return std::forward<CrossoverOperator>(op);
+            } else {
+                return [op = std::forward<CrossoverOperator>(op)](
+                           const ChromosomeType& first, const ChromosomeType& second,
+                           ChromosomeType& child) mutable {
+                    child = std::invoke(op, first, second);
+                };
+            }
+        }
+
+        /// @brief Copies a crossover operator that makes both children in one call, other
+        /// operators give an empty crossover_pair_operator_type.
+        template <typename CrossoverOperator>
+        static crossover_pair_operator_type make_crossover_pair_operator(
+            const CrossoverOperator& op) {
+            if constexpr (concepts::crossover_pair_operator<CrossoverOperator, ChromosomeType>) {
+                return op;
+            } else {
+                return nullptr;
+            }
+        }
+
+        /**
+         * @brief Type erases a selection operator so that it works on a scored population.
+         * @details The erased operator is called once per generation and returns a parent
+         * selector that draws pairs of parents from that generation, see
+         * details::make_parent_selector.
+         */
+        template <typename SelectionOperator>
+        static selection_operator_type make_selection_operator(SelectionOperator&& op) {
+            return [op = std::forward<SelectionOperator>(op)](
+                       const scored_population_type& population,
+                       const fitness_evaluation_type& fitness) -> parent_selector_type {
+                return details::make_parent_selector<PopulationType>(op, population, fitness);
+            };
+        }
+
         mutation_operator_type mutator_;
+        // declared before crossover_, which may take the operator by move
+        crossover_pair_operator_type crossover_pair_;
         crossover_operator_type crossover_;
         fitness_evaluation_type fitness_;
+        batch_fitness_evaluation_type batch_fitness_;
         termination_evaluation_type termination_;
         selection_operator_type selection_;
+        bool mutation_modifies_{true};
+        bool sorted_population_{false};
+    };
+
+    /**
+     * @brief Algorithm parameters where every operator keeps its own type.
+     * @details Unlike params, the operators are not stored in std::function, so solve() calls
+     * them directly and the compiler can inline them. Use this when the operators are cheap and
+     * the cost of an indirect call per operation matters. The builder has the same interface as
+     * params::builder, but every call returns a new builder for the new operator type. Like
+     * params, the operators are shared by the worker tasks of solve() and must be safe to call
+     * concurrently.
+     * @tparam ChromosomeType The chromosome type.
+     * @tparam PopulationType The population type.
+     */
+    template <typename ChromosomeType, typename PopulationType = std::vector<ChromosomeType>,
+              class FitnessOperator = details::accumulation_fitness_op,
+              class MutationOperator = no_op_mutator, class CrossoverOperator = random_crossover,
+              class SelectionOperator = roulette_selection,
+              class TerminationOperator = generations_termination>
+        requires concepts::population<PopulationType, ChromosomeType> &&
+                 concepts::fitness_operator<FitnessOperator, ChromosomeType> &&
+                 concepts::any_mutation_operator<MutationOperator, ChromosomeType> &&
+                 concepts::any_crossover_operator<CrossoverOperator, ChromosomeType> &&
+                 concepts::termination_operator<TerminationOperator, ChromosomeType, double>
+    class static_params {
+      public:
+        /// @brief Type definitions
+        /// @{
+        using value_type = ChromosomeType;
+        using population_type = PopulationType;
+        using fitness_operator_type = FitnessOperator;
+        using mutation_operator_type = MutationOperator;
+        using crossover_operator_type = CrossoverOperator;
+        using selection_operator_type = SelectionOperator;
+        using termination_operator_type = TerminationOperator;
+        using scored_chromosome_type = std::pair<ChromosomeType, double>;
+        using scored_population_type = std::vector<scored_chromosome_type>;
+        using parent_buffer_type = std::pair<scored_chromosome_type, scored_chromosome_type>;
+        /// @}
+
+        explicit static_params(FitnessOperator fitness = FitnessOperator{},
+                               MutationOperator mutator = MutationOperator{},
+                               CrossoverOperator crosser = CrossoverOperator{},
+                               SelectionOperator selection = SelectionOperator{},
+                               TerminationOperator terminator = TerminationOperator{})
+            : fitness_(std::move(fitness)),
+              mutator_(std::move(mutator)),
+              crossover_(std::move(crosser)),
+              selection_(std::move(selection)),
+              termination_(std::move(terminator)) {}
+
+        [[nodiscard]] auto&& fitness_operator() const { return fitness_; }
+        [[nodiscard]] auto&& mutation_operator() const { return mutator_; }
+        [[nodiscard]] auto&& crossover_operator() const { return crossover_; }
+        [[nodiscard]] auto&& termination_operator() const { return termination_; }
+        [[nodiscard]] auto&& selection_operator() const { return selection_; }
+
+        /// @brief Whether the selection operator needs the population sorted by fitness, see
+        /// details::requires_sorted_population.
+        [[nodiscard]] static constexpr bool requires_sorted_population() {
+            return details::requires_sorted_population<PopulationType, SelectionOperator,
+                                                       scored_population_type>();
+        }
+
+        /// @brief Whether the fitness operator scores batches of chromosomes, see
+        /// concepts::batch_fitness_operator.
+        [[nodiscard]] static constexpr bool has_batch_fitness() {
+            return concepts::batch_fitness_operator<const FitnessOperator, ChromosomeType>;
+        }
+        /// @brief The batch fitness operator, the same as fitness_operator().
+        [[nodiscard]] auto&& batch_fitness_operator() const { return fitness_; }
+
+        /// @brief Whether the crossover operator makes both children of two parents in one
+        /// call, see concepts::crossover_pair_operator.
+        [[nodiscard]] static constexpr bool has_pair_crossover() {
+            return concepts::crossover_pair_operator<CrossoverOperator&, ChromosomeType>;
+        }
+        /// @brief The pair crossover operator, the same as crossover_operator().
+        [[nodiscard]] auto&& crossover_pair_operator() const { return crossover_; }
+
+        /// @brief Whether the mutation operator can change a chromosome, see
+        /// details::mutation_modifies_chromosome.
+        [[nodiscard]] static constexpr bool mutation_modifies_chromosome() {
+            return details::mutation_modifies_chromosome<MutationOperator>();
+        }
+
+        /// @brief Creates the parent selector for one generation, see
+        /// details::make_parent_selector.
+        [[nodiscard]] auto parent_selector(const scored_population_type& population) const {
+            return details::make_parent_selector<PopulationType>(selection_, population,
+                                                                 fitness_);
+        }
+
+        /// @brief builder class that helps with parameter construction
+        class builder {
+          public:
+            builder() = default;
+            explicit builder(static_params data) : data_(std::move(data)) {}
+
+            /// @brief Sets the fitness operator, batch-only fitness operators are wrapped with
+            /// details::single_from_batch_fitness.
+            template <concepts::any_fitness_operator<ChromosomeType> Fn>
+            [[nodiscard]] auto with_fitness_operator(Fn&& op) const {
+                auto fitness = details::make_single_fitness<ChromosomeType>(std::forward<Fn>(op));
+                using next = static_params<ChromosomeType, PopulationType, decltype(fitness),
+                                           MutationOperator, CrossoverOperator, SelectionOperator,
+                                           TerminationOperator>;
+                return typename next::builder{next{std::move(fitness), data_.mutator_,
+                                                   data_.crossover_, data_.selection_,
+                                                   data_.termination_}};
+            }
+
+            template <concepts::any_mutation_operator<ChromosomeType> Fn>
+            [[nodiscard]] auto with_mutation_operator(Fn&& op) const {
+                using next = static_params<ChromosomeType, PopulationType, FitnessOperator,
+                                           std::remove_cvref_t<Fn>, CrossoverOperator,
+                                           SelectionOperator, TerminationOperator>;
+                return typename next::builder{next{data_.fitness_, std::forward<Fn>(op),
+                                                   data_.crossover_, data_.selection_,
+                                                   data_.termination_}};
+            }
+
+            template <concepts::any_crossover_operator<ChromosomeType> Fn>
+            [[nodiscard]] auto with_crossover_operator(Fn&& op) const {
+                using next = static_params<ChromosomeType, PopulationType, FitnessOperator,
+                                           MutationOperator, std::remove_cvref_t<Fn>,
+                                           SelectionOperator, TerminationOperator>;
+                return typename next::builder{next{data_.fitness_, data_.mutator_,
+                                                   std::forward<Fn>(op), data_.selection_,
+                                                   data_.termination_}};
+            }
+
+            template <typename UnaryOp = FitnessOperator,
+                      concepts::selection_operator<ChromosomeType, PopulationType, UnaryOp> Fn>
+            [[nodiscard]] auto with_selection_operator(Fn&& op) const {
+                using next = static_params<ChromosomeType, PopulationType, FitnessOperator,
+                                           MutationOperator, CrossoverOperator,
+                                           std::remove_cvref_t<Fn>, TerminationOperator>;
+                return typename next::builder{next{data_.fitness_, data_.mutator_,
+                                                   data_.crossover_, std::forward<Fn>(op),
+                                                   data_.termination_}};
+            }
+
+            template <concepts::termination_operator<ChromosomeType, double> Fn>
+            [[nodiscard]] auto with_termination_operator(Fn&& op) const {
+                using next = static_params<ChromosomeType, PopulationType, FitnessOperator,
+                                           MutationOperator, CrossoverOperator,
+                                           SelectionOperator, std::remove_cvref_t<Fn>>;
+                return typename next::builder{next{data_.fitness_, data_.mutator_,
+                                                   data_.crossover_, data_.selection_,
+                                                   std::forward<Fn>(op)}};
+            }
+
+            [[nodiscard]] auto build() const { return data_; }
+
+          private:
+            static_params data_{};
+        };
+
+      private:
+        // operators are not required to be const callable, the same as with std::function.
+        // They are still called concurrently by solve().
+        mutable FitnessOperator fitness_;
+        mutable MutationOperator mutator_;
+        mutable CrossoverOperator crossover_;
+        SelectionOperator selection_;
+        mutable TerminationOperator termination_;
     };
 }  // namespace dp::genetic
@@ -0,0 +1,203 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "genetic/details/concepts.h"
+#include "genetic/details/memory.h"
+
+namespace dp::genetic {
+    /**
+     * @brief Structure of arrays population for fixed length numeric chromosomes.
+     * @details The genes of every chromosome are stored in one contiguous, aligned matrix with
+     * one row per chromosome, and the fitness of every chromosome is stored in a separate
+     * array. Chromosomes are accessed as std::span rows, so fitness operators stream over
+     * contiguous memory. Ordering the population (i.e. sorting it or picking the elites) only
+     * works on indices; the rows are only moved by permute().
+     *
+     * This is a standalone container, solve() does not use it. solve() default constructs and
+     * writes into its chromosomes and keeps (chromosome, fitness) pairs, and a std::span row
+     * can not be default constructed. To run solve() on the population, copy the rows into owning
+     * chromosomes such as std::array<T, Genes>.
+     * @tparam T The gene type.
+     * @tparam Genes The number of genes of every chromosome, std::dynamic_extent if it is only
+     * known at runtime.
+     */
+    template <type_traits::number T, std::size_t Genes = std::dynamic_extent>
+    class population_matrix {
+      public:
+        /// @brief Type definitions
+        /// @{
+        using value_type = T;
+        using chromosome_type = std::span<T, Genes>;
+        using const_chromosome_type = std::span<const T, Genes>;
+        using gene_storage_type = std::vector<T, details::aligned_allocator<T>>;
+        /// @}
+
+        population_matrix() = default;
+
+        /// @brief Creates a population of size chromosomes with value initialized genes.
+        explicit population_matrix(std::size_t size)
+            requires(Genes != std::dynamic_extent)
+            : population_matrix(size, Genes) {}
+
+        /// @brief Creates a population of size chromosomes with gene_count genes each.
+        population_matrix(std::size_t size, std::size_t gene_count)
+            : gene_count_(gene_count), genes_(size * gene_count), fitness_(size) {
+            assert(Genes == std::dynamic_extent || gene_count == Genes);
+        }
+
+        /**
+         * @brief Copies a range of chromosomes into the matrix.
+         * @details Every chromosome must have the same number of genes. With a dynamic extent the
+         * number of genes is taken from the first chromosome.
+         */
+        template <std::ranges::input_range Chromosomes>
+            requires std::ranges::input_range<std::ranges::range_reference_t<Chromosomes>> &&
+                     std::convertible_to<
+                         std::ranges::range_value_t<std::ranges::range_reference_t<Chromosomes>>,
+                         T>
+        explicit population_matrix(Chromosomes&& chromosomes) {
+            for (auto&& chromosome : chromosomes) push_back(chromosome);
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept { return fitness_.size(); }
+        [[nodiscard]] bool empty() const noexcept { return fitness_.empty(); }
+        [[nodiscard]] std::size_t gene_count() const noexcept { return gene_count_; }
+
+        [[nodiscard]] chromosome_type operator[](std::size_t index) noexcept {
+            return chromosome_type(genes_.data() + index * gene_count_, gene_count_);
+        }
+
+        [[nodiscard]] const_chromosome_type operator[](std::size_t index) const noexcept {
+            return const_chromosome_type(genes_.data() + index * gene_count_, gene_count_);
+        }
+
+        /// @brief The whole gene matrix, row by row.
+        [[nodiscard]] std::span<T> genes() noexcept { return genes_; }
+        [[nodiscard]] std::span<const T> genes() const noexcept { return genes_; }
+
+        /// @brief The fitness of every chromosome, in row order.
+        [[nodiscard]] std::span<double> fitness() noexcept { return fitness_; }
+        [[nodiscard]] std::span<const double> fitness() const noexcept { return fitness_; }
+
+        /// @brief Random access view of the chromosomes (rows), satisfies concepts::population
+        /// but can not be passed to solve(), see the class description.
+        [[nodiscard]] auto rows() noexcept {
+            return std::views::iota(std::size_t{0}, size()) |
+                   std::views::transform([this](std::size_t index) { return (*this)[index]; });
+        }
+
+        [[nodiscard]] auto rows() const noexcept {
+            return std::views::iota(std::size_t{0}, size()) |
+                   std::views::transform([this](std::size_t index) { return (*this)[index]; });
+        }
+
+        /// @brief Changes the number of chromosomes, new chromosomes are value initialized.
+        void resize(std::size_t size) {
+            genes_.resize(size * gene_count_);
+            fitness_.resize(size);
+        }
+
+        void reserve(std::size_t size) {
+            genes_.reserve(size * gene_count_);
+            fitness_.reserve(size);
+        }
+
+        /// @brief Appends a copy of a chromosome, its fitness is 0 until evaluate() is called.
+        template <std::ranges::input_range Chromosome>
+            requires std::convertible_to<std::ranges::range_value_t<Chromosome>, T>
+        void push_back(const Chromosome& chromosome) {
+            if constexpr (Genes == std::dynamic_extent) {
+                if (empty()) {
+                    gene_count_ = static_cast<std::size_t>(std::ranges::distance(chromosome));
+                }
+            }
+            const auto previous_size = genes_.size();
+            genes_.insert(genes_.end(), std::ranges::begin(chromosome),
+                          std::ranges::end(chromosome));
+            assert(genes_.size() - previous_size == gene_count_);
+            fitness_.push_back(0.0);
+        }
+
+        /**
+         * @brief Evaluates the fitness of every chromosome.
+         * @param fitness_op Fitness operator that accepts a const_chromosome_type.
+         */
+        template <concepts::fitness_operator<const_chromosome_type> FitnessOperator>
+        void evaluate(FitnessOperator&& fitness_op) {
+            for (std::size_t index = 0; index < size(); ++index) {
+                fitness_[index] = static_cast<double>(std::invoke(fitness_op, (*this)[index]));
+            }
+        }
+
+        /// @brief The indices of the chromosomes from best to worst, ties keep their row order.
+        [[nodiscard]] std::vector<std::size_t> order() const {
+            auto indices = make_indices();
+            std::ranges::stable_sort(indices, better());
+            return indices;
+        }
+
+        /**
+         * @brief The indices of the count best chromosomes, from best to worst.
+         * @details Only the best count chromosomes are sorted, which makes this O(N + k log k)
+         * instead of O(N log N) for a full order.
+         */
+        [[nodiscard]] std::vector<std::size_t> best(std::size_t count) const {
+            auto indices = make_indices();
+            count = std::min(count, indices.size());
+            const auto last = indices.begin() + static_cast<std::ptrdiff_t>(count);
+            std::ranges::nth_element(indices, last, better());
+            std::ranges::sort(indices.begin(), last, better());
+            indices.resize(count);
+            return indices;
+        }
+
+        /**
+         * @brief Rearranges the rows in the given order.
+         * @details Row i of the result is row indices[i] of the current population, so indices
+         * can also be a subset (i.e. the elites) or repeat rows. The rows are gathered into
+         * storage that is kept for the next call, so permuting a population of the same size
+         * again does not allocate.
+         * @param indices The rows of the new population.
+         */
+        void permute(std::span<const std::size_t> indices) {
+            scratch_genes_.resize(indices.size() * gene_count_);
+            scratch_fitness_.resize(indices.size());
+            for (std::size_t row = 0; row < indices.size(); ++row) {
+                const auto source = (*this)[indices[row]];
+                std::ranges::copy(source, scratch_genes_.begin() +
+                                              static_cast<std::ptrdiff_t>(row * gene_count_));
+                scratch_fitness_[row] = fitness_[indices[row]];
+            }
+            genes_.swap(scratch_genes_);
+            fitness_.swap(scratch_fitness_);
+        }
+
+      private:
+        [[nodiscard]] std::vector<std::size_t> make_indices() const {
+            std::vector<std::size_t> indices(size());
+            std::iota(indices.begin(), indices.end(), std::size_t{0});
+            return indices;
+        }
+
+        [[nodiscard]] auto better() const {
+            return [this](std::size_t first, std::size_t second) {
+                return fitness_[first] > fitness_[second];
+            };
+        }
+
+        std::size_t gene_count_{Genes == std::dynamic_extent ? 0 : Genes};
+        gene_storage_type genes_{};
+        std::vector<double> fitness_{};
+        gene_storage_type scratch_genes_{};
+        std::vector<double> scratch_fitness_{};
+    };
+}  // namespace dp::genetic
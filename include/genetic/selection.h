@@ -6,12 +6,29 @@
 #include <numeric>
 #include <random>
 #include <ranges>
+#include <tuple>
 #include <utility>
 
 #include "genetic/op/selection/rank_selection.h"
 #include "genetic/op/selection/roulette_selection.h"
+#include "genetic/op/selection/tournament_selection.h"
 
 namespace dp::genetic {
+    namespace details {
+        /**
+         * @brief Projects the cached fitness out of a scored (chromosome, fitness) pair.
+         * @details Lets any generic selection operator run over a population that has already
+         * been evaluated without calling the fitness operator again.
+         */
+        struct cached_fitness_op {
+            template <typename ScoredChromosome>
+            constexpr auto operator()(const ScoredChromosome& scored) const {
+                return std::get<1>(scored);
+            }
+        };
+    }  // namespace details
+
+    inline constexpr auto cached_fitness = details::cached_fitness_op{};
 
     /**
      * @brief Select parents from a population using the provided selection operator.
@@ -36,4 +53,64 @@ namespace dp::genetic {
                            std::forward<FitnessOperator>(fitness_op));
     }
 
+    /**
+     * @brief Select parents from a population that has already been scored.
+     * @details Each element of the population is a (chromosome, fitness) pair. The selection
+     * operator is run over the pairs using the cached fitness, so no fitness evaluations are
+     * performed. Only the chromosomes of the selected pairs are returned.
+     * @param selection_op The selection operator.
+     * @param scored_population Range of (chromosome, fitness) pairs.
+     * @return The two selected parents.
+     */
+    template <std::ranges::random_access_range ScoredPopulation, typename SelectionOperator,
+              typename ScoredChromosome = std::ranges::range_value_t<ScoredPopulation>,
+              typename T = std::tuple_element_t<0, ScoredChromosome>>
+        requires concepts::selection_operator<
+            SelectionOperator, ScoredChromosome,
+            std::ranges::ref_view<const std::remove_cvref_t<ScoredPopulation>>,
+            details::cached_fitness_op>
+    constexpr inline std::pair<T, T> select_parents(SelectionOperator&& selection_op,
+                                                    const ScoredPopulation& scored_population) {
+        auto [first, second] = std::invoke(std::forward<SelectionOperator>(selection_op),
+                                           std::views::all(scored_population), cached_fitness);
+        return {std::get<0>(std::move(first)), std::get<0>(std::move(second))};
+    }
+
+    /**
+     * @brief Prepare a selection operator to draw many parent pairs from the same population.
+     * @details The returned sampler draws the indices of two parents each time it is called.
+     * @param selection_op The selection operator.
+     * @param population The population to select from.
+     * @param fitness_op The fitness operator.
+     * @return The parent sampler.
+     */
+    template <std::ranges::random_access_range Population, typename SelectionOperator,
+              typename FitnessOperator>
+        requires concepts::prepared_selection_operator<SelectionOperator, Population,
+                                                       FitnessOperator>
+    [[nodiscard]] constexpr inline auto prepare_selection(SelectionOperator&& selection_op,
+                                                          Population&& population,
+                                                          FitnessOperator&& fitness_op) {
+        return std::forward<SelectionOperator>(selection_op)
+            .prepare(std::forward<Population>(population),
+                     std::forward<FitnessOperator>(fitness_op));
+    }
+
+    /**
+     * @brief Prepare a selection operator to draw many parent pairs from a scored population.
+     * @details Uses the cached fitness of each (chromosome, fitness) pair.
+     * @param selection_op The selection operator.
+     * @param scored_population Range of (chromosome, fitness) pairs.
+     * @return The parent sampler.
+     */
+    template <std::ranges::random_access_range ScoredPopulation, typename SelectionOperator>
+        requires concepts::prepared_selection_operator<
+            SelectionOperator, std::ranges::ref_view<const std::remove_cvref_t<ScoredPopulation>>,
+            details::cached_fitness_op>
+    [[nodiscard]] constexpr inline auto prepare_selection(
+        SelectionOperator&& selection_op, const ScoredPopulation& scored_population) {
+        return std::forward<SelectionOperator>(selection_op)
+            .prepare(std::views::all(scored_population), cached_fitness);
+    }
+
 }  // namespace dp::genetic
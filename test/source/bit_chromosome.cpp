@@ -0,0 +1,211 @@
+#include <doctest/doctest.h>
+#include <genetic/bit_chromosome.h>
+#include <genetic/crossover.h>
+#include <genetic/details/concepts.h>
+#include <genetic/fitness.h>
+#include <genetic/fitness_cache.h>
+#include <genetic/genetic.h>
+#include <genetic/mutation.h>
+#include <genetic/termination.h>
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <vector>
+
+using fixed_bits = dp::genetic::bit_chromosome<100>;
+using dynamic_bits = dp::genetic::bit_chromosome<>;
+
+static_assert(std::ranges::random_access_range<const fixed_bits>);
+static_assert(std::ranges::sized_range<const dynamic_bits>);
+static_assert(std::random_access_iterator<fixed_bits::const_iterator>);
+static_assert(sizeof(fixed_bits) <= 2 * sizeof(std::size_t) + 100 / 8);
+static_assert(dp::genetic::concepts::crossover_into_operator<dp::genetic::random_crossover,
+                                                             fixed_bits>);
+static_assert(dp::genetic::concepts::crossover_into_operator<dp::genetic::uniform_crossover,
+                                                             dynamic_bits>);
+static_assert(dp::genetic::concepts::in_place_mutation_operator<dp::genetic::bit_flip_mutator,
+                                                                fixed_bits>);
+static_assert(dp::genetic::concepts::hashable_chromosome<dynamic_bits>);
+
+namespace {
+    /// @brief Whether the child is a prefix of the first parent followed by a suffix of the
+    /// second parent.
+    bool is_spliced(const dynamic_bits& first, const dynamic_bits& second,
+                    const dynamic_bits& child) {
+        for (std::size_t pivot = 0; pivot <= std::min(first.size(), child.size()); ++pivot) {
+            const auto second_part = child.size() - pivot;
+            if (second_part > second.size()) continue;
+            const auto second_pivot = second.size() - second_part;
+            bool matches = true;
+            for (std::size_t i = 0; i < child.size() && matches; ++i) {
+                matches = child[i] == (i < pivot ? first[i] : second[second_pivot + i - pivot]);
+            }
+            if (matches) return true;
+        }
+        return false;
+    }
+}  // namespace
+
+TEST_CASE("Bit chromosome stores one bit per gene") {
+    const std::vector<int> genes{1, 0, 0, 1, 1, 0, 1};
+    const dynamic_bits bits(genes);
+    REQUIRE(bits.size() == genes.size());
+    CHECK(std::ranges::equal(bits, genes, [](bool bit, int gene) { return bit == (gene != 0); }));
+    CHECK(bits.count() == 4);
+    CHECK(bits.words().size() == 1);
+
+    dynamic_bits ones(130, true);
+    CHECK(ones.count() == 130);
+    CHECK(ones.words().size() == 3);
+    // the unused bits of the last word stay 0
+    CHECK(ones.words().back() == 0b11);
+    ones.flip();
+    CHECK(ones.count() == 0);
+    CHECK(ones.words().back() == 0);
+
+    fixed_bits fixed{};
+    fixed.set(3);
+    fixed.set(64);
+    fixed.set(99);
+    fixed.flip(3);
+    CHECK(fixed.count() == 2);
+    std::vector<std::size_t> set_bits{};
+    fixed.for_each_set_bit([&set_bits](std::size_t index) { set_bits.push_back(index); });
+    CHECK(set_bits == std::vector<std::size_t>{64, 99});
+
+    fixed_bits other{};
+    other.set(64);
+    CHECK(fixed.count_equal(other) == 99);
+    CHECK(fixed != other);
+    other.set(99);
+    CHECK(fixed == other);
+    CHECK(std::hash<fixed_bits>{}(fixed) == std::hash<fixed_bits>{}(other));
+
+    const dynamic_bits shorter{true, false, true};
+    CHECK(shorter.count_equal(bits) == 2);
+}
+
+TEST_CASE("Bits are copied between unaligned positions") {
+    dynamic_bits source(200);
+    for (std::size_t i = 0; i < source.size(); i += 3) source.set(i);
+
+    for (const auto [source_position, destination_position, count] :
+         {std::array<std::size_t, 3>{0, 0, 200}, {5, 70, 100}, {63, 1, 130}, {64, 64, 64}}) {
+        dynamic_bits destination(300, true);
+        dp::genetic::details::copy_bits(source.words(), source_position, destination.words(),
+                                        destination_position, count);
+        for (std::size_t i = 0; i < destination.size(); ++i) {
+            const auto copied = i >= destination_position && i < destination_position + count;
+            const auto expected =
+                copied ? source[source_position + i - destination_position] : true;
+            CHECK(destination[i] == expected);
+        }
+    }
+}
+
+TEST_CASE("Bit chromosome crossover") {
+    dynamic_bits first(150);
+    dynamic_bits second(90, true);
+    for (std::size_t i = 0; i < first.size(); i += 2) first.set(i);
+
+    dynamic_bits child{};
+    dp::genetic::random_crossover crossover{};
+    for (int i = 0; i < 20; ++i) {
+        dp::genetic::make_children_into(crossover, first, second, child);
+        CHECK(is_spliced(first, second, child));
+    }
+
+    // chromosomes of a fixed size keep their size
+    fixed_bits zeros{};
+    fixed_bits ones{};
+    ones.flip();
+    const auto fixed_child = dp::genetic::make_children(crossover, zeros, ones);
+    // the child is a run of zeros followed by a run of ones
+    std::size_t changes{0};
+    for (std::size_t i = 1; i < fixed_child.size(); ++i) {
+        changes += fixed_child[i] != fixed_child[i - 1];
+    }
+    CHECK(changes <= 1);
+    CHECK(fixed_child.count() == fixed_child.size() - fixed_child.count_equal(zeros));
+
+    // every bit of a uniform crossover child comes from one of the parents, about half of them
+    // from each
+    dynamic_bits many_zeros(6'400);
+    dynamic_bits many_ones(6'400, true);
+    const auto uniform_child =
+        dp::genetic::make_children(dp::genetic::uniform_crossover{}, many_zeros, many_ones);
+    REQUIRE(uniform_child.size() == 6'400);
+    CHECK(uniform_child.count() > 2'800);
+    CHECK(uniform_child.count() < 3'600);
+
+    // the child has the size of the first parent
+    const auto short_child =
+        dp::genetic::make_children(dp::genetic::uniform_crossover{}, dynamic_bits(70), many_ones);
+    CHECK(short_child.size() == 70);
+    CHECK(short_child.words().back() >> 6 == 0);
+
+    // genes past the end of the shorter parent come from the longer parent, also within the
+    // last shared word
+    const auto long_child =
+        dp::genetic::make_children(dp::genetic::uniform_crossover{}, many_ones, dynamic_bits(70));
+    REQUIRE(long_child.size() == 6'400);
+    for (std::size_t index = 70; index < 128; ++index) CHECK(long_child.test(index));
+    CHECK(long_child.count() >= 6'400 - 70);
+
+    // and the same holds for both children of a pair
+    dynamic_bits long_pair_child{};
+    dynamic_bits short_pair_child{};
+    dp::genetic::uniform_crossover{}(many_ones, dynamic_bits(70), long_pair_child,
+                                     short_pair_child);
+    REQUIRE(long_pair_child.size() == 6'400);
+    REQUIRE(short_pair_child.size() == 70);
+    for (std::size_t index = 70; index < 128; ++index) CHECK(long_pair_child.test(index));
+    CHECK(long_pair_child.count() + short_pair_child.count() == 70 + (6'400 - 70));
+}
+
+TEST_CASE("Bit flip mutation") {
+    const dynamic_bits zeros(10'000);
+
+    CHECK(dp::genetic::bit_flip_mutator{0.0}(zeros) == zeros);
+    CHECK(dp::genetic::bit_flip_mutator{1.0}(zeros).count() == zeros.size());
+
+    const auto mutated = dp::genetic::mutate(dp::genetic::bit_flip_mutator{0.1}, zeros);
+    CHECK(mutated.count() > 800);
+    CHECK(mutated.count() < 1'200);
+}
+
+TEST_CASE("Fitness operators count bits") {
+    const dynamic_bits solution{true, false, true, true, false};
+    const dynamic_bits value{true, true, true, false};
+    CHECK(dp::genetic::accumulation_fitness(solution) == 3.0);
+    // 2 matches, 1 gene shorter than the solution
+    CHECK(dp::genetic::element_wise_comparison(solution, 1.0)(value) == 1.0);
+}
+
+TEST_CASE("Solve a bit chromosome problem") {
+    // maximize the number of set bits
+    using bits = dp::genetic::bit_chromosome<256>;
+    std::vector<bits> initial_population(100);
+    const dp::genetic::bit_flip_mutator initial_mutator{0.2};
+    for (auto& chromosome : initial_population) initial_mutator(chromosome);
+
+    const auto params = dp::genetic::static_params<bits>::builder()
+                            .with_fitness_operator(dp::genetic::accumulation_fitness)
+                            .with_mutation_operator(dp::genetic::bit_flip_mutator{0.005})
+                            .with_crossover_operator(dp::genetic::uniform_crossover{})
+                            .with_termination_operator(
+                                [generations = dp::genetic::generations_termination{2'000}](
+                                    const bits& best, double fitness) mutable {
+                                    // stop at the optimum, the limit keeps a failure from hanging
+                                    return fitness >= 256.0 || generations(best, fitness);
+                                })
+                            .build();
+    const auto [best, fitness] = dp::genetic::solve(
+        initial_population,
+        dp::genetic::algorithm_settings{.elitism_rate = 0.1, .thread_count = 1, .seed = 7},
+        params);
+    CHECK(fitness == 256.0);
+    CHECK(best.count() == 256);
+}
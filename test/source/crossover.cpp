@@ -1,8 +1,12 @@
 #include <doctest/doctest.h>
 #include <genetic/crossover.h>
 
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <iostream>
+#include <memory_resource>
+#include <ranges>
 #include <string>
 #include <vector>
 
@@ -15,6 +19,8 @@ static_assert(concepts::crossover_operator<random_crossover, std::string>);
 static_assert(concepts::crossover_operator<random_crossover, std::array<int, 4>>);
 static_assert(concepts::crossover_operator<random_crossover, std::vector<int>>);
 static_assert(concepts::crossover_operator<random_crossover, std::vector<std::string>>);
+static_assert(concepts::crossover_into_operator<random_crossover, std::string>);
+static_assert(concepts::crossover_into_operator<random_crossover, std::pmr::string>);
 
 TEST_CASE("Test generic cross technique") {
     constexpr auto first_point = 2;
@@ -68,3 +74,167 @@ TEST_CASE("Test default crossover operator") {
 
     std::cout << child1 << '\n' << child2 << '\n' << std::endl;
 }
+
+TEST_CASE("Crossover children keep the allocator of their storage") {
+    std::pmr::monotonic_buffer_resource parent_resource{};
+    std::pmr::monotonic_buffer_resource child_resource{};
+    const std::pmr::string p1(64, 'a', &parent_resource);
+    const std::pmr::string p2(64, 'b', &parent_resource);
+
+    // a new child allocates from the same resource as its parents
+    random_crossover crossover{};
+    const auto child = dp::genetic::make_children(crossover, p1, p2);
+    CHECK(child.get_allocator().resource() == &parent_resource);
+
+    // a child written into an existing chromosome keeps its allocator and its storage
+    std::pmr::string output(128, 'c', &child_resource);
+    const auto* storage = output.data();
+    dp::genetic::make_children_into(crossover, p1, p2, output);
+    CHECK(output.get_allocator().resource() == &child_resource);
+    CHECK(output.data() == storage);
+    CHECK(std::ranges::all_of(output, [](char value) { return value == 'a' || value == 'b'; }));
+}
+
+static_assert(concepts::crossover_into_operator<uniform_crossover, std::vector<int>>);
+static_assert(concepts::crossover_pair_operator<uniform_crossover, std::vector<int>>);
+static_assert(concepts::crossover_pair_operator<uniform_crossover, std::array<char, 8>>);
+static_assert(concepts::crossover_pair_operator<two_point_crossover, std::string>);
+static_assert(concepts::crossover_operator<k_point_crossover<3>, std::vector<int>>);
+static_assert(concepts::crossover_pair_operator<blend_crossover, std::vector<double>>);
+static_assert(concepts::crossover_pair_operator<arithmetic_crossover, std::array<float, 4>>);
+static_assert(concepts::crossover_pair_operator<simulated_binary_crossover, std::vector<double>>);
+static_assert(!concepts::crossover_into_operator<blend_crossover, std::vector<int>>);
+static_assert(!concepts::crossover_pair_operator<random_crossover, std::vector<int>>);
+
+namespace {
+    /// @brief Number of runs of genes that were taken from the same parent.
+    std::size_t count_segments(const std::vector<int>& child) {
+        std::size_t segments{0};
+        for (std::size_t index = 0; index < child.size(); ++index) {
+            if (index == 0 || child[index] != child[index - 1]) ++segments;
+        }
+        return segments;
+    }
+}  // namespace
+
+TEST_CASE("Uniform crossover") {
+    const std::vector<int> first(1'000, 1);
+    const std::vector<int> second(1'000, 2);
+
+    std::vector<int> first_child(1'000);
+    std::vector<int> second_child(1'000);
+    const auto* storage = first_child.data();
+    dp::genetic::make_children_pair_into(uniform_crossover{}, first, second, first_child,
+                                         second_child);
+    CHECK(first_child.data() == storage);
+    std::size_t from_first{0};
+    for (std::size_t index = 0; index < first.size(); ++index) {
+        // the children take complementary genes
+        CHECK(first_child[index] + second_child[index] == 3);
+        if (first_child[index] == 1) ++from_first;
+    }
+    CHECK(from_first > 400);
+    CHECK(from_first < 600);
+
+    // genes that the second parent does not have come from the first
+    const std::vector<int> short_parent(10, 2);
+    const auto child = dp::genetic::make_children(uniform_crossover{}, first, short_parent);
+    REQUIRE(child.size() == first.size());
+    CHECK(std::ranges::all_of(child | std::views::drop(10), [](int gene) { return gene == 1; }));
+}
+
+TEST_CASE("K-point crossover") {
+    const std::vector<int> first(200, 1);
+    const std::vector<int> second(200, 2);
+
+    std::vector<int> first_child{};
+    std::vector<int> second_child{};
+    for (int run = 0; run < 50; ++run) {
+        k_point_crossover<3>{}(first, second, first_child, second_child);
+        REQUIRE(first_child.size() == first.size());
+        REQUIRE(second_child.size() == second.size());
+        CHECK(count_segments(first_child) <= 4);
+        for (std::size_t index = 0; index < first.size(); ++index) {
+            CHECK(first_child[index] + second_child[index] == 3);
+        }
+    }
+
+    // children keep the size of their own parent
+    const std::vector<int> short_parent(20, 2);
+    two_point_crossover{}(first, short_parent, first_child, second_child);
+    CHECK(first_child.size() == first.size());
+    CHECK(second_child.size() == short_parent.size());
+    CHECK(std::ranges::all_of(first_child | std::views::drop(20),
+                              [](int gene) { return gene == 1; }));
+
+    const auto child = dp::genetic::make_children(two_point_crossover{}, std::string(16, 'a'),
+                                                  std::string(16, 'b'));
+    CHECK(child.size() == 16);
+    CHECK(std::ranges::all_of(child, [](char gene) { return gene == 'a' || gene == 'b'; }));
+}
+
+TEST_CASE("Blend and arithmetic crossover") {
+    const std::vector<double> first{0.0, 1.0, -2.0, 5.0};
+    const std::vector<double> second{1.0, 1.0, 2.0, 3.0};
+
+    std::vector<double> first_child{};
+    std::vector<double> second_child{};
+    for (int run = 0; run < 100; ++run) {
+        blend_crossover{0.5}(first, second, first_child, second_child);
+        REQUIRE(first_child.size() == first.size());
+        for (std::size_t index = 0; index < first.size(); ++index) {
+            const auto width = std::abs(first[index] - second[index]);
+            const auto lower = std::min(first[index], second[index]) - 0.5 * width;
+            const auto upper = std::max(first[index], second[index]) + 0.5 * width;
+            CHECK(first_child[index] >= lower);
+            CHECK(first_child[index] <= upper);
+            CHECK(first_child[index] + second_child[index] ==
+                  doctest::Approx(first[index] + second[index]));
+        }
+    }
+
+    arithmetic_crossover{0.25}(first, second, first_child, second_child);
+    CHECK(first_child[0] == doctest::Approx(0.75));
+    CHECK(second_child[0] == doctest::Approx(0.25));
+    CHECK(first_child[2] == doctest::Approx(1.0));
+    CHECK(second_child[3] == doctest::Approx(4.5));
+
+    const auto child = dp::genetic::make_children(arithmetic_crossover{}, first, second);
+    for (std::size_t index = 0; index < first.size(); ++index) {
+        CHECK(child[index] >= std::min(first[index], second[index]) - 1e-12);
+        CHECK(child[index] <= std::max(first[index], second[index]) + 1e-12);
+    }
+}
+
+TEST_CASE("Simulated binary crossover") {
+    const std::vector<double> first{0.0, 1.0, -2.0, 5.0, 4.0};
+    const std::vector<double> second{1.0, 1.0, 2.0, 3.0};
+
+    std::vector<double> first_child{};
+    std::vector<double> second_child{};
+    for (int run = 0; run < 100; ++run) {
+        simulated_binary_crossover{2.0}(first, second, first_child, second_child);
+        REQUIRE(first_child.size() == first.size());
+        REQUIRE(second_child.size() == second.size());
+        // the children keep the mean of the parents
+        for (std::size_t index = 0; index < second.size(); ++index) {
+            CHECK(first_child[index] + second_child[index] ==
+                  doctest::Approx(first[index] + second[index]));
+        }
+        CHECK(first_child[1] == doctest::Approx(1.0));
+        CHECK(first_child[4] == 4.0);
+    }
+}
+
+TEST_CASE("Pair crossover falls back to two calls") {
+    const std::string first(8, 'a');
+    const std::string second(8, 'b');
+    std::string first_child{};
+    std::string second_child{};
+    const auto swap_halves = [](const std::string& a, const std::string& b) {
+        return a.substr(0, 4) + b.substr(4);
+    };
+    dp::genetic::make_children_pair_into(swap_halves, first, second, first_child, second_child);
+    CHECK(first_child == "aaaabbbb");
+    CHECK(second_child == "bbbbaaaa");
+}
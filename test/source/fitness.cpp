@@ -1,10 +1,60 @@
 #include <doctest/doctest.h>
 #include <genetic/details/concepts.h>
+#include <genetic/execution.h>
 #include <genetic/fitness.h>
+#include <thread_pool/thread_pool.h>
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <future>
+#include <list>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
+namespace {
+    /// @brief Batch-only fitness operator that scores strings by their length.
+    struct length_batch_fitness {
+        std::size_t* calls{};
+
+        void operator()(std::span<const std::string> chromosomes, std::span<double> fitness) const {
+            ++*calls;
+            for (std::size_t i = 0; i < chromosomes.size(); ++i) {
+                fitness[i] = static_cast<double>(chromosomes[i].size());
+            }
+        }
+    };
+
+    /// @brief Fitness operator that counts how often it is copied.
+    struct copy_counting_fitness {
+        std::size_t* copies{};
+
+        explicit copy_counting_fitness(std::size_t* copy_count) : copies(copy_count) {}
+        copy_counting_fitness(const copy_counting_fitness& other) : copies(other.copies) {
+            ++*copies;
+        }
+        copy_counting_fitness& operator=(const copy_counting_fitness&) = default;
+
+        double operator()(const std::vector<double>& value) const {
+            return static_cast<double>(value.size());
+        }
+    };
+}  // namespace
+
+static_assert(dp::genetic::concepts::batch_fitness_operator<length_batch_fitness, std::string>);
+static_assert(!dp::genetic::concepts::fitness_operator<length_batch_fitness, std::string>);
+static_assert(!dp::genetic::concepts::batch_fitness_operator<
+              dp::genetic::details::accumulation_fitness_op, std::string>);
+static_assert(dp::genetic::concepts::fitness_operator<
+              dp::genetic::details::single_from_batch_fitness<length_batch_fitness>, std::string>);
+
 static_assert(dp::genetic::concepts::fitness_operator<dp::genetic::details::accumulation_fitness_op,
                                                       std::string>);
 static_assert(std::invocable<decltype(dp::genetic::accumulation_fitness), std::string>);
@@ -40,6 +90,44 @@ TEST_CASE("Element-wise fitness") {
     CHECK(fitness == 1.0);
 }
 
+TEST_CASE("Contiguous fitness kernels") {
+    // long enough to be compared word by word, with a tail that is not a full word
+    std::string solution(67, 'a');
+    std::string value = solution;
+    for (std::size_t i = 0; i < value.size(); i += 5) value[i] = 'b';
+    std::size_t expected_matches{0};
+    for (std::size_t i = 0; i < value.size(); ++i) expected_matches += value[i] == solution[i];
+
+    CHECK(dp::genetic::details::count_equal(std::span<const char>(solution),
+                                            std::span<const char>(value)) == expected_matches);
+
+    // the result matches the generic path used for ranges that are not contiguous
+    const dp::genetic::element_wise_comparison contiguous_fitness(solution, 2.0);
+    const dp::genetic::element_wise_comparison list_fitness(
+        std::list<char>(solution.begin(), solution.end()), 2.0);
+    CHECK(contiguous_fitness(value) == 2.0 * static_cast<double>(expected_matches));
+    CHECK(contiguous_fitness(value) == list_fitness(std::list<char>(value.begin(), value.end())));
+
+    // differences in length are subtracted
+    const auto shorter = value.substr(0, 30);
+    CHECK(contiguous_fitness(shorter) ==
+          list_fitness(std::list<char>(shorter.begin(), shorter.end())));
+
+    const std::vector<int> int_solution{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    const std::vector<int> int_value{1, 0, 3, 0, 5, 0, 7, 0, 9, 0, 11};
+    CHECK(dp::genetic::evaluate_fitness(dp::genetic::element_wise_comparison(int_solution, 1.0),
+                                        int_value) == 4.0);
+
+    std::vector<double> values(1'001);
+    std::iota(values.begin(), values.end(), 0.0);
+    const std::deque<double> deque_values(values.begin(), values.end());
+    CHECK(dp::genetic::accumulation_fitness(values) == 500'500.0);
+    CHECK(dp::genetic::accumulation_fitness(values) ==
+          dp::genetic::accumulation_fitness(deque_values));
+    static constexpr std::array digits{1, 2, 3, 4, 5, 6, 7, 8, 9};
+    static_assert(dp::genetic::details::sum<double>(std::span<const int>(digits)) == 45.0);
+}
+
 TEST_CASE("Composite fitness") {
     const std::vector data{1.0, 2.0, 3.0, 4.0};
     const std::vector solution{1.0, 2.0, 4.0};
@@ -86,3 +174,134 @@ TEST_CASE("Composite fitness") {
     const auto product_fitness = dp::genetic::evaluate_fitness(composite_product, data);
     CHECK(product_fitness == fitness * diff_fitness * data.size() * 2);
 }
+
+TEST_CASE("Composite fitness does not copy its operators") {
+    const std::vector data{1.0, 2.0, 3.0, 4.0};
+    std::size_t copies{0};
+    dp::genetic::composite_sum_fitness composite{
+        dp::genetic::accumulation_fitness, copy_counting_fitness{&copies},
+        copy_counting_fitness{&copies}};
+
+    copies = 0;
+    CHECK(composite(data) == 10.0 + 4.0 + 4.0);
+    CHECK(copies == 0);
+}
+
+namespace {
+    /// @brief Executor that only runs tasks without a result.
+    struct void_executor {
+        [[nodiscard]] std::size_t size() const { return 1; }
+        [[nodiscard]] std::future<void> enqueue(std::function<void()> task) {
+            task();
+            std::promise<void> done{};
+            done.set_value();
+            return done.get_future();
+        }
+    };
+
+    using size_fitness = double (*)(const std::vector<double>&);
+
+    /// @brief Executor that runs the first task on its own thread and fails to start the rest.
+    struct failing_executor {
+        std::size_t started{0};
+
+        [[nodiscard]] std::size_t size() const { return 1; }
+
+        template <typename Function, typename ReturnType = std::invoke_result_t<Function>>
+        [[nodiscard]] std::future<ReturnType> enqueue(Function&& function) {
+            if (started++ > 0) throw std::runtime_error("enqueue");
+            // unlike std::async, the future does not wait for the task when it is destroyed
+            std::packaged_task<ReturnType()> task(std::forward<Function>(function));
+            auto result = task.get_future();
+            std::thread(std::move(task)).detach();
+            return result;
+        }
+    };
+}  // namespace
+
+// composite fitness only accepts executors that return the result of each operator
+static_assert(dp::genetic::concepts::executor<void_executor>);
+static_assert(!dp::genetic::concepts::value_executor<void_executor, double>);
+static_assert(dp::genetic::concepts::value_executor<dp::genetic::inline_executor, double>);
+static_assert(dp::genetic::concepts::value_executor<dp::thread_pool<>, double>);
+static_assert(!std::invocable<dp::genetic::composite_sum_fitness<size_fitness, size_fitness>&,
+                              void_executor&, const std::vector<double>&>);
+static_assert(std::invocable<dp::genetic::composite_sum_fitness<size_fitness, size_fitness>&,
+                             dp::genetic::inline_executor&, const std::vector<double>&>);
+
+TEST_CASE("Composite fitness on an executor") {
+    const std::vector data{1.0, 2.0, 3.0, 4.0};
+    const auto size = [](const std::vector<double>& value) {
+        return static_cast<double>(value.size());
+    };
+    dp::genetic::composite_difference_fitness composite{dp::genetic::accumulation_fitness, size,
+                                                        [](const auto&) { return 1.0; }};
+
+    // the results are combined in the same order as a sequential evaluation
+    dp::thread_pool pool(2);
+    CHECK(composite(pool, data) == composite(data));
+    dp::genetic::inline_executor executor{};
+    CHECK(composite(executor, data) == 10.0 - 4.0 - 1.0);
+
+    // exceptions of any operator reach the caller once every operator has finished
+    dp::genetic::composite_sum_fitness throwing{
+        size, [](const std::vector<double>&) -> double { throw std::runtime_error("fitness"); }};
+    CHECK_THROWS_AS(throwing(executor, data), std::runtime_error);
+}
+
+TEST_CASE("Composite fitness waits for started tasks when enqueue throws") {
+    const std::vector data{1.0, 2.0, 3.0, 4.0};
+    std::atomic_bool finished{false};
+    const auto slow = [&finished](const std::vector<double>& value) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        finished = true;
+        return static_cast<double>(value.size());
+    };
+    const auto size = [](const std::vector<double>& value) {
+        return static_cast<double>(value.size());
+    };
+    dp::genetic::composite_sum_fitness composite{size, slow, size};
+
+    failing_executor executor{};
+    CHECK_THROWS_AS(composite(executor, data), std::runtime_error);
+    // the task that did start has finished before the exception reached the caller
+    CHECK(finished);
+}
+
+TEST_CASE("Compensated accumulation fitness") {
+    // a plain sum loses the small values next to the large ones
+    const std::vector values{1.0, 1e100, 1.0, -1e100};
+    CHECK(dp::genetic::accumulation_fitness(values) == 0.0);
+    CHECK(dp::genetic::compensated_accumulation_fitness(values) == 2.0);
+
+    std::vector<double> tenths(10'000, 0.1);
+    CHECK(dp::genetic::compensated_accumulation_fitness(tenths) ==
+          doctest::Approx(1'000.0).epsilon(1e-15));
+
+    const std::list<float> floats{1.f, 2.f, 3.f};
+    CHECK(dp::genetic::compensated_accumulation_fitness(floats) == 6.0);
+}
+
+TEST_CASE("Batch fitness") {
+    const std::vector<std::string> chromosomes{"a", "abc", "ab"};
+    std::vector<double> fitness(chromosomes.size());
+
+    // batch operators are called once for the whole batch
+    std::size_t calls{0};
+    dp::genetic::evaluate_fitness_batch(length_batch_fitness{&calls},
+                                        std::span<const std::string>(chromosomes), fitness);
+    CHECK(calls == 1);
+    CHECK(fitness == std::vector{1.0, 3.0, 2.0});
+
+    // other operators are called once per chromosome
+    dp::genetic::evaluate_fitness_batch(
+        [](const std::string& value) { return static_cast<int>(value.size()) * 2; },
+        std::span<const std::string>(chromosomes), fitness);
+    CHECK(fitness == std::vector{2.0, 6.0, 4.0});
+
+    // a batch operator can also score single chromosomes
+    const auto single =
+        dp::genetic::details::make_single_fitness<std::string>(length_batch_fitness{&calls});
+    CHECK(dp::genetic::evaluate_fitness(single, std::string("abcd")) == 4.0);
+    CHECK(calls == 2);
+}
@@ -0,0 +1,126 @@
+#include <doctest/doctest.h>
+#include <genetic/fitness_cache.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <thread>
+#include <vector>
+
+static_assert(dp::genetic::concepts::hashable_chromosome<std::string>);
+static_assert(dp::genetic::concepts::hashable_chromosome<std::vector<int>>);
+static_assert(dp::genetic::concepts::hashable_chromosome<std::array<double, 2>>);
+static_assert(!dp::genetic::concepts::hashable_chromosome<std::vector<std::vector<int>>>);
+
+TEST_CASE("Fitness cache only evaluates a chromosome once") {
+    std::size_t fitness_calls{0};
+    const auto fitness = [&fitness_calls](const std::vector<int>& value) {
+        ++fitness_calls;
+        return static_cast<double>(value.size());
+    };
+
+    dp::genetic::fitness_cache<std::vector<int>> cache(100);
+    CHECK(cache.get_or_evaluate({1, 2, 3}, fitness) == 3.0);
+    CHECK(cache.get_or_evaluate({1, 2, 3}, fitness) == 3.0);
+    CHECK(cache.get_or_evaluate({1, 2}, fitness) == 2.0);
+    CHECK(fitness_calls == 2);
+    CHECK(cache.size() == 2);
+
+    const auto statistics = cache.statistics();
+    CHECK(statistics.hits == 1);
+    CHECK(statistics.misses == 2);
+    CHECK(statistics.hit_rate() == doctest::Approx(1.0 / 3.0));
+
+    CHECK(cache.find({1, 2}) == 2.0);
+    CHECK_FALSE(cache.find({4}).has_value());
+    cache.insert({4}, 10.0);
+    CHECK(cache.find({4}) == 10.0);
+
+    cache.clear();
+    CHECK(cache.size() == 0);
+    CHECK_FALSE(cache.find({1, 2, 3}).has_value());
+}
+
+TEST_CASE("Fitness cache stays within its capacity") {
+    constexpr std::size_t capacity = 64;
+    dp::genetic::fitness_cache<int> cache(capacity);
+    for (int i = 0; i < 10'000; ++i) cache.insert(i, static_cast<double>(i));
+    CHECK(cache.size() <= capacity);
+    CHECK(cache.size() > 0);
+}
+
+TEST_CASE("Fitness cache evicts chromosomes that were not used recently") {
+    // every chromosome goes to the same shard, which holds two chromosomes
+    struct same_shard_hash {
+        std::size_t operator()(int) const { return 0; }
+    };
+    dp::genetic::fitness_cache<int, same_shard_hash> cache(
+        2 * dp::genetic::fitness_cache<int, same_shard_hash>::shard_count);
+
+    cache.insert(1, 1.0);
+    cache.insert(2, 2.0);
+    // a lookup gives 1 a second chance, so 2 is evicted
+    CHECK(cache.find(1) == 1.0);
+    cache.insert(3, 3.0);
+    CHECK(cache.size() == 2);
+    CHECK(cache.find(1) == 1.0);
+    CHECK(cache.find(3) == 3.0);
+    CHECK_FALSE(cache.find(2).has_value());
+
+    // when every chromosome was used, the hand takes their second chance and comes back to 1
+    cache.insert(4, 4.0);
+    CHECK(cache.size() == 2);
+    CHECK(cache.find(4) == 4.0);
+    CHECK(cache.find(3) == 3.0);
+    CHECK_FALSE(cache.find(1).has_value());
+
+    // inserting an existing chromosome keeps its fitness
+    cache.insert(3, 30.0);
+    CHECK(cache.find(3) == 3.0);
+}
+
+TEST_CASE("Fitness cache keeps its own copy of pmr chromosomes") {
+    dp::genetic::fitness_cache<std::pmr::string> cache(100);
+    {
+        // the chromosome lives in a buffer that is overwritten once the chromosome is cached
+        std::array<char, 256> buffer{};
+        std::pmr::monotonic_buffer_resource resource(buffer.data(), buffer.size(),
+                                                     std::pmr::null_memory_resource());
+        cache.insert(std::pmr::string("a chromosome that does not fit the small string buffer",
+                                      &resource),
+                     1.0);
+        buffer.fill('x');
+    }
+    CHECK(cache.find(std::pmr::string("a chromosome that does not fit the small string buffer"))
+          == 1.0);
+}
+
+TEST_CASE("Fitness cache is shared by multiple threads") {
+    std::atomic<std::size_t> fitness_calls{0};
+    const auto fitness = [&fitness_calls](const std::string& value) {
+        ++fitness_calls;
+        return static_cast<double>(value.size());
+    };
+
+    constexpr std::size_t distinct_values = 100;
+    dp::genetic::fitness_cache<std::string> cache(1'000);
+    std::vector<std::thread> threads{};
+    for (std::size_t thread = 0; thread < 4; ++thread) {
+        threads.emplace_back([&] {
+            for (std::size_t i = 0; i < 10 * distinct_values; ++i) {
+                const auto value = std::string(i % distinct_values + 1, 'a');
+                CHECK(cache.get_or_evaluate(value, fitness) == static_cast<double>(value.size()));
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    // threads may evaluate the same chromosome at the same time, but only once each
+    CHECK(cache.size() == distinct_values);
+    CHECK(fitness_calls.load() >= distinct_values);
+    CHECK(fitness_calls.load() <= 4 * distinct_values);
+    const auto statistics = cache.statistics();
+    CHECK(statistics.hits + statistics.misses == 4 * 10 * distinct_values);
+}
@@ -1,6 +1,7 @@
 #include <doctest/doctest.h>
 #include <genetic/crossover.h>
 #include <genetic/details/concepts.h>
+#include <genetic/fitness.h>
 #include <genetic/genetic.h>
 #include <genetic/mutation.h>
 #include <genetic/selection.h>
@@ -8,13 +9,24 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cassert>
 #include <chrono>
+#include <cstdint>
 #include <cstdlib>
 #include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
 #include <numbers>
+#include <numeric>
 #include <random>
+#include <span>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
 
 // type declaration for knapsack problem
 // declared here to be used in ostream operator
@@ -232,10 +244,15 @@ TEST_CASE("Beale function") {
 
     std::vector<data_t> initial_population;
 
-    // generate our initial population
-    std::ranges::generate_n(std::back_inserter(initial_population), 10'000, [&generate_value]() {
-        return std::array{generate_value(), generate_value()};
-    });
+    // generate our initial population, seeded like the solve below so the test is reproducible
+    constexpr std::uint_least64_t seed = 1;
+    {
+        dp::genetic::details::random_stream_scope random_stream(seed, 0);
+        std::ranges::generate_n(std::back_inserter(initial_population), 10'000,
+                                [&generate_value]() {
+                                    return std::array{generate_value(), generate_value()};
+                                });
+    }
 
     constexpr double increment = 0.00001;
 
@@ -250,8 +267,14 @@ TEST_CASE("Beale function") {
                             .with_termination_operator(termination)
                             .build();
 
+    // the large initial population finds the basin of the minimum, a small population then
+    // refines the best solutions
     const auto [best, _] = dp::genetic::solve(
-        initial_population, dp::genetic::algorithm_settings{.elitism_rate = 0.25}, params,
+        initial_population,
+        dp::genetic::algorithm_settings{
+            .elitism_rate = 0.25, .mutation_rate = 1.0, .population_size = 10,
+            .thread_count = 2, .seed = seed},
+        params,
         [](auto& stats) {
             std::cout << std::format("best: [{}, {}]", stats.current_best.best[0],
                                      stats.current_best.best[1])
@@ -277,9 +300,13 @@ TEST_CASE("sin(x)") {
 
     std::vector<data_t> initial_population;
 
-    // generate our initial population
-    std::ranges::generate_n(std::back_inserter(initial_population), 10'000,
-                            [&generate_value]() { return std::array{generate_value()}; });
+    // generate our initial population, seeded like the solve below so the test is reproducible
+    constexpr std::uint_least64_t seed = 1;
+    {
+        dp::genetic::details::random_stream_scope random_stream(seed, 0);
+        std::ranges::generate_n(std::back_inserter(initial_population), 10'000,
+                                [&generate_value]() { return std::array{generate_value()}; });
+    }
 
     constexpr double increment = 0.00001;
 
@@ -294,8 +321,14 @@ TEST_CASE("sin(x)") {
                             .with_termination_operator(termination)
                             .build();
 
+    // the large initial population finds the basin of the minimum, a small population then
+    // refines the best solutions
     const auto [best, _] = dp::genetic::solve(
-        initial_population, dp::genetic::algorithm_settings{.elitism_rate = 0.25}, params,
+        initial_population,
+        dp::genetic::algorithm_settings{
+            .elitism_rate = 0.25, .mutation_rate = 1.0, .population_size = 10,
+            .thread_count = 2, .seed = seed},
+        params,
         [](auto& stats) {
             std::cout << std::format("best: [{}, {}]", stats.current_best.best[0],
                                      stats.current_best.fitness)
@@ -306,3 +339,939 @@ TEST_CASE("sin(x)") {
     const auto [x] = best;
     CHECK(x == doctest::Approx(std::numbers::pi / 2.).epsilon(0.001));
 }
+
+TEST_CASE("Fitness is evaluated once per new chromosome") {
+    std::atomic<std::size_t> fitness_calls{0};
+    const auto fitness = [&fitness_calls](const std::string& value) -> double {
+        ++fitness_calls;
+        return static_cast<double>(std::ranges::count(value, 'a'));
+    };
+
+    constexpr auto population_size = 100;
+    const std::vector<std::string> initial_population(population_size, "abcd");
+
+    const auto params = dp::genetic::params<std::string>::builder()
+                            .with_fitness_operator(fitness)
+                            .with_termination_operator(dp::genetic::generations_termination{5})
+                            .build();
+
+    constexpr dp::genetic::algorithm_settings settings{.crossover_rate = 0.2};
+    std::size_t generations{0};
+    dp::genetic::solve(initial_population, settings, params, [&](auto&) { ++generations; });
+
+    // each generation evaluates at most the children it creates, selection uses cached fitness
+    CHECK(generations > 0);
+    CHECK(fitness_calls.load() <= population_size + generations * population_size);
+}
+
+TEST_CASE("Crossover and mutation rates are probabilities") {
+    std::atomic<std::size_t> fitness_calls{0};
+    std::atomic<std::size_t> crossover_calls{0};
+    std::atomic<std::size_t> mutation_calls{0};
+
+    constexpr std::size_t population_size = 50;
+    constexpr std::size_t generations = 10;
+    std::vector<std::string> initial_population{};
+    for (std::size_t i = 0; i < population_size; ++i) {
+        initial_population.push_back(std::string(i % 7 + 1, 'a'));
+    }
+
+    const auto params =
+        dp::genetic::params<std::string>::builder()
+            .with_fitness_operator([&fitness_calls](const std::string& value) {
+                ++fitness_calls;
+                return static_cast<double>(value.size());
+            })
+            .with_mutation_operator([&mutation_calls](std::string& value) {
+                ++mutation_calls;
+                value.push_back('b');
+            })
+            .with_crossover_operator([&crossover_calls](const std::string& first,
+                                                        const std::string& second,
+                                                        std::string& child) {
+                ++crossover_calls;
+                child = first.substr(0, first.size() / 2) + second.substr(second.size() / 2);
+            })
+            .with_termination_operator(dp::genetic::generations_termination{generations})
+            .build();
+
+    const auto run = [&](double crossover_rate, double mutation_rate) {
+        fitness_calls = 0;
+        crossover_calls = 0;
+        mutation_calls = 0;
+        const dp::genetic::algorithm_settings settings{.mutation_rate = mutation_rate,
+                                                       .crossover_rate = crossover_rate,
+                                                       .thread_count = 1,
+                                                       .seed = 3};
+        std::size_t generation_count{0};
+        dp::genetic::solve(initial_population, settings, params, [&](const auto& stats) {
+            CHECK(stats.population_size == population_size);
+            ++generation_count;
+        });
+        return generation_count;
+    };
+
+    {
+        // children are copies of their parents when both rates are 0
+        const auto generation_count = run(0.0, 0.0);
+        CHECK(crossover_calls.load() == 0);
+        CHECK(mutation_calls.load() == 0);
+        // the children reuse the fitness of their parents, only the initial population is
+        // evaluated
+        CHECK(fitness_calls.load() == population_size);
+        CHECK(generation_count > 0);
+    }
+
+    {
+        // every child is crossed over and mutated when both rates are 1
+        const auto generation_count = run(1.0, 1.0);
+        CHECK(crossover_calls.load() == generation_count * population_size);
+        CHECK(mutation_calls.load() == generation_count * population_size);
+        CHECK(fitness_calls.load() == population_size + generation_count * population_size);
+    }
+
+    {
+        // only the children that changed are evaluated
+        const auto generation_count = run(0.2, 0.1);
+        const auto children = generation_count * population_size;
+        CHECK(crossover_calls.load() > 0);
+        CHECK(crossover_calls.load() < children);
+        CHECK(mutation_calls.load() > 0);
+        CHECK(mutation_calls.load() < children);
+        CHECK(fitness_calls.load() < population_size + children);
+    }
+}
+
+TEST_CASE("Pair crossover operators make both children in one call") {
+    // counts how often each overload is called
+    struct counting_crossover {
+        std::atomic<std::size_t>* single_calls;
+        std::atomic<std::size_t>* pair_calls;
+
+        void operator()(const std::string& first, const std::string& second,
+                        std::string& child) const {
+            ++*single_calls;
+            dp::genetic::two_point_crossover{}(first, second, child);
+        }
+        void operator()(const std::string& first, const std::string& second,
+                        std::string& first_child, std::string& second_child) const {
+            ++*pair_calls;
+            dp::genetic::two_point_crossover{}(first, second, first_child, second_child);
+        }
+    };
+    static_assert(dp::genetic::concepts::crossover_pair_operator<counting_crossover, std::string>);
+
+    // an odd number of children, the last child is made on its own
+    constexpr std::size_t population_size = 51;
+    const std::vector<std::string> initial_population(population_size, "abcdef");
+    std::atomic<std::size_t> single_calls{0};
+    std::atomic<std::size_t> pair_calls{0};
+
+    const auto run = [&](auto builder) {
+        single_calls = 0;
+        pair_calls = 0;
+        const auto params =
+            builder
+                .with_fitness_operator(
+                    dp::genetic::element_wise_comparison(std::string{"fedcba"}, 1.0))
+                .with_crossover_operator(counting_crossover{&single_calls, &pair_calls})
+                .with_termination_operator(dp::genetic::generations_termination{5})
+                .build();
+        CHECK(params.has_pair_crossover());
+        std::size_t generation_count{0};
+        dp::genetic::solve(initial_population,
+                           dp::genetic::algorithm_settings{
+                               .mutation_rate = 0.0, .crossover_rate = 1.0, .thread_count = 1},
+                           params, [&](const auto&) { ++generation_count; });
+        CHECK(generation_count > 0);
+        CHECK(pair_calls.load() == generation_count * (population_size / 2));
+        CHECK(single_calls.load() == generation_count);
+    };
+    run(dp::genetic::params<std::string>::builder());
+    run(dp::genetic::static_params<std::string>::builder());
+
+    const auto params = dp::genetic::params<std::string>::builder()
+                            .with_crossover_operator(dp::genetic::random_crossover{})
+                            .build();
+    CHECK_FALSE(params.has_pair_crossover());
+}
+
+TEST_CASE("Population size is stable and configurable") {
+    const std::vector<std::string> initial_population(20, "abcd");
+    const auto params = dp::genetic::params<std::string>::builder()
+                            .with_fitness_operator([](const std::string& value) {
+                                return static_cast<double>(std::ranges::count(value, 'a'));
+                            })
+                            .with_termination_operator(dp::genetic::generations_termination{6})
+                            .build();
+
+    for (const std::size_t population_size : {std::size_t{0}, std::size_t{7}, std::size_t{64}}) {
+        const dp::genetic::algorithm_settings settings{
+            .elitism_rate = 0.1, .population_size = population_size, .thread_count = 1};
+        const auto expected_size =
+            population_size == 0 ? initial_population.size() : population_size;
+        std::size_t generations{0};
+        dp::genetic::solve(initial_population, settings, params, [&](const auto& stats) {
+            CHECK(stats.population_size == expected_size);
+            ++generations;
+        });
+        CHECK(generations > 0);
+    }
+}
+
+TEST_CASE("Unchanged children are not evaluated again") {
+    std::atomic<std::size_t> fitness_calls{0};
+    const auto fitness = [&fitness_calls](const std::string& value) {
+        ++fitness_calls;
+        return static_cast<double>(std::ranges::count(value, 'a'));
+    };
+    // crossover that passes the first parent on, so every child equals one of its parents
+    const auto clone_first = [](const std::string& first, const std::string&, std::string& child) {
+        child = first;
+    };
+
+    constexpr std::size_t population_size = 30;
+    constexpr std::size_t generations = 5;
+    std::vector<std::string> initial_population{};
+    for (std::size_t i = 0; i < population_size; ++i) {
+        initial_population.push_back(std::string(i % 5 + 1, 'a'));
+    }
+
+    const auto run = [&](const auto& params, bool compare_with_parents) {
+        fitness_calls = 0;
+        const dp::genetic::algorithm_settings settings{.mutation_rate = 1.0,
+                                                       .crossover_rate = 1.0,
+                                                       .compare_with_parents = compare_with_parents,
+                                                       .thread_count = 1,
+                                                       .seed = 11};
+        std::size_t generation_count{0};
+        dp::genetic::solve(initial_population, settings, params,
+                           [&generation_count](const auto&) { ++generation_count; });
+        return generation_count;
+    };
+
+    // the no-op mutator never changes a chromosome, so it is not called and children that are
+    // copies of their parents keep their fitness
+    const auto no_op_params =
+        dp::genetic::params<std::string>::builder()
+            .with_fitness_operator(fitness)
+            .with_crossover_operator(clone_first)
+            .with_termination_operator(dp::genetic::generations_termination{generations})
+            .build();
+    CHECK_FALSE(no_op_params.mutation_modifies_chromosome());
+
+    // without the comparison every crossed over child is evaluated
+    auto generation_count = run(no_op_params, false);
+    CHECK(fitness_calls.load() == population_size + generation_count * population_size);
+    // with it, the children get the fitness of the parent they equal
+    generation_count = run(no_op_params, true);
+    CHECK(generation_count > 0);
+    CHECK(fitness_calls.load() == population_size);
+
+    const auto static_params =
+        dp::genetic::static_params<std::string>::builder()
+            .with_fitness_operator(fitness)
+            .with_crossover_operator(clone_first)
+            .with_termination_operator(dp::genetic::generations_termination{generations})
+            .build();
+    static_assert(!decltype(static_params)::mutation_modifies_chromosome());
+    generation_count = run(static_params, true);
+    CHECK(generation_count > 0);
+    CHECK(fitness_calls.load() == population_size);
+
+    // a mutation operator that may change the chromosome is called and its children evaluated
+    // unless they equal a parent
+    const auto mutating_params =
+        dp::genetic::params<std::string>::builder()
+            .with_fitness_operator(fitness)
+            .with_mutation_operator([](std::string& value) {
+                if (value.size() > 3) value.pop_back();
+            })
+            .with_crossover_operator(clone_first)
+            .with_termination_operator(dp::genetic::generations_termination{generations})
+            .build();
+    generation_count = run(mutating_params, true);
+    CHECK(fitness_calls.load() > population_size);
+    CHECK(fitness_calls.load() < population_size + generation_count * population_size);
+}
+
+TEST_CASE("Fitness cache skips chromosomes that were evaluated before") {
+    std::atomic<std::size_t> fitness_calls{0};
+    const auto fitness = [&fitness_calls](const std::string& value) {
+        ++fitness_calls;
+        return static_cast<double>(std::ranges::count(value, 'a'));
+    };
+
+    // a small alphabet and short strings make the population converge quickly
+    std::vector<std::string> initial_population{};
+    for (std::size_t i = 0; i < 64; ++i) {
+        initial_population.push_back(std::string(i % 3 + 1, i % 2 == 0 ? 'a' : 'b'));
+    }
+
+    const auto params =
+        dp::genetic::params<std::string>::builder()
+            .with_fitness_operator(fitness)
+            .with_mutation_operator([](std::string& value) {
+                if (value.empty()) {
+                    value.push_back('a');
+                    return;
+                }
+                auto& character = value[dp::genetic::uniform_integral_generator{}(
+                    std::size_t{0}, value.size() - 1)];
+                character = character == 'a' ? 'b' : 'a';
+            })
+            .with_crossover_operator(dp::genetic::random_crossover{})
+            .with_termination_operator(dp::genetic::generations_termination{30})
+            .build();
+
+    const auto run = [&](std::size_t cache_capacity) {
+        fitness_calls = 0;
+        const dp::genetic::algorithm_settings settings{.elitism_rate = 0.1,
+                                                       .fitness_cache_capacity = cache_capacity,
+                                                       .thread_count = 2,
+                                                       .seed = 5};
+        std::vector<double> history{};
+        dp::genetic::cache_statistics lookups{};
+        dp::genetic::solve(initial_population, settings, params, [&](const auto& stats) {
+            history.push_back(stats.current_best.fitness);
+            lookups.hits += stats.fitness_cache_lookups.hits;
+            lookups.misses += stats.fitness_cache_lookups.misses;
+        });
+        return std::pair{history, lookups};
+    };
+
+    const auto [uncached_history, uncached_lookups] = run(0);
+    const auto uncached_calls = fitness_calls.load();
+    CHECK(uncached_lookups.hits == 0);
+    CHECK(uncached_lookups.misses == 0);
+
+    const auto [cached_history, cached_lookups] = run(1'000);
+    const auto cached_calls = fitness_calls.load();
+
+    // the cache does not change the result, only how often fitness is evaluated
+    CHECK(cached_history == uncached_history);
+    CHECK(cached_calls < uncached_calls);
+    CHECK(cached_lookups.hits > 0);
+    // every miss is an evaluation, the misses of the initial population are not reported
+    CHECK(cached_lookups.misses <= cached_calls);
+    CHECK(cached_calls - cached_lookups.misses <= initial_population.size());
+}
+
+TEST_CASE("Batch fitness operators score the children of every task in batches") {
+    std::atomic<std::size_t> batch_calls{0};
+    std::atomic<std::size_t> largest_batch{0};
+    std::atomic<std::size_t> scored{0};
+    const auto batch_fitness = [&](std::span<const std::string> chromosomes,
+                                   std::span<double> fitness) {
+        ++batch_calls;
+        scored += chromosomes.size();
+        auto largest = largest_batch.load();
+        while (chromosomes.size() > largest &&
+               !largest_batch.compare_exchange_weak(largest, chromosomes.size())) {
+        }
+        for (std::size_t i = 0; i < chromosomes.size(); ++i) {
+            fitness[i] = static_cast<double>(std::ranges::count(chromosomes[i], 'a'));
+        }
+    };
+    const auto single_fitness = [](const std::string& value) {
+        return static_cast<double>(std::ranges::count(value, 'a'));
+    };
+
+    std::vector<std::string> initial_population{};
+    for (std::size_t i = 0; i < 100; ++i) {
+        initial_population.push_back(std::string(i % 4 + 1, i % 3 == 0 ? 'a' : 'b'));
+    }
+    const auto mutator = [](std::string& value) { value.push_back('a'); };
+
+    const auto run = [&](const auto& params, std::size_t batch_size, std::size_t cache_size) {
+        batch_calls = 0;
+        largest_batch = 0;
+        scored = 0;
+        const dp::genetic::algorithm_settings settings{.elitism_rate = 0.1,
+                                                       .fitness_cache_capacity = cache_size,
+                                                       .fitness_batch_size = batch_size,
+                                                       .thread_count = 2,
+                                                       .seed = 9};
+        std::vector<double> history{};
+        dp::genetic::solve(initial_population, settings, params,
+                           [&history](const auto& stats) {
+                               history.push_back(stats.current_best.fitness);
+                           });
+        return history;
+    };
+
+    const auto make_params = [&mutator](auto builder, const auto& fitness) {
+        return builder.with_fitness_operator(fitness)
+            .with_mutation_operator(mutator)
+            .with_termination_operator(dp::genetic::generations_termination{10})
+            .build();
+    };
+    const auto single_params =
+        make_params(dp::genetic::params<std::string>::builder(), single_fitness);
+    const auto batch_params =
+        make_params(dp::genetic::params<std::string>::builder(), batch_fitness);
+    const auto static_batch_params =
+        make_params(dp::genetic::static_params<std::string>::builder(), batch_fitness);
+    CHECK_FALSE(single_params.has_batch_fitness());
+    CHECK(batch_params.has_batch_fitness());
+    static_assert(decltype(static_batch_params)::has_batch_fitness());
+
+    // batches give the same results as scoring one chromosome at a time
+    const auto expected = run(single_params, 0, 0);
+    CHECK(batch_calls.load() == 0);
+
+    CHECK(run(batch_params, 0, 0) == expected);
+    CHECK(largest_batch.load() == initial_population.size());
+    const auto unlimited_calls = batch_calls.load();
+    const auto uncached_scored = scored.load();
+
+    CHECK(run(batch_params, 8, 0) == expected);
+    CHECK(largest_batch.load() == 8);
+    CHECK(batch_calls.load() > unlimited_calls);
+
+    CHECK(run(static_batch_params, 8, 0) == expected);
+    CHECK(largest_batch.load() == 8);
+
+    // only the chromosomes that are not in the cache are scored
+    CHECK(run(batch_params, 0, 1'000) == expected);
+    CHECK(scored.load() < uncached_scored);
+}
+
+namespace {
+    std::atomic<std::size_t> chromosome_copies{0};
+
+    /// @brief Chromosome that counts how often it is copied, moves are free.
+    struct tracked_chromosome {
+        std::vector<int> genes{};
+
+        tracked_chromosome() = default;
+        explicit tracked_chromosome(std::vector<int> values) : genes(std::move(values)) {}
+        tracked_chromosome(const tracked_chromosome& other) : genes(other.genes) {
+            ++chromosome_copies;
+        }
+        tracked_chromosome(tracked_chromosome&&) noexcept = default;
+        tracked_chromosome& operator=(const tracked_chromosome& other) {
+            genes = other.genes;
+            ++chromosome_copies;
+            return *this;
+        }
+        tracked_chromosome& operator=(tracked_chromosome&&) noexcept = default;
+        auto operator<=>(const tracked_chromosome&) const = default;
+
+        // container interface so that the default operators can be used with it
+        using value_type = int;
+        using size_type = std::size_t;
+        [[nodiscard]] auto begin() const { return genes.begin(); }
+        [[nodiscard]] auto end() const { return genes.end(); }
+        [[nodiscard]] size_type size() const { return genes.size(); }
+        [[nodiscard]] bool empty() const { return genes.empty(); }
+        void reserve(size_type size) { genes.reserve(size); }
+        void push_back(int value) { genes.push_back(value); }
+    };
+}  // namespace
+
+TEST_CASE("Chromosomes are only copied when a new individual is created") {
+    constexpr std::size_t population_size = 100;
+    constexpr std::size_t generations = 5;
+    std::vector<tracked_chromosome> initial_population{};
+    for (std::size_t i = 0; i < population_size; ++i) {
+        initial_population.emplace_back(std::vector<int>{static_cast<int>(i), 1, 2, 3});
+    }
+
+    const auto params =
+        dp::genetic::params<tracked_chromosome>::builder()
+            .with_fitness_operator([](const tracked_chromosome& value) {
+                return static_cast<double>(value.genes.front());
+            })
+            .with_mutation_operator([](tracked_chromosome value) {
+                std::ranges::reverse(value.genes);
+                return value;
+            })
+            .with_crossover_operator(
+                [](const tracked_chromosome& first, const tracked_chromosome& second) {
+                    return tracked_chromosome{std::vector<int>{first.genes.front(),
+                                                               second.genes.back()}};
+                })
+            .with_termination_operator(dp::genetic::generations_termination{generations + 1})
+            .build();
+
+    chromosome_copies = 0;
+    constexpr dp::genetic::algorithm_settings settings{
+        .elitism_rate = 0.1, .crossover_rate = 1.0, .thread_count = 1};
+    dp::genetic::solve(initial_population, settings, params);
+
+    // the initial population is copied once, after that only the best chromosome is copied
+    // (to track it and report it), parents and children are never copied
+    CHECK(chromosome_copies.load() <= population_size + 3 + 2 * generations);
+}
+
+namespace {
+    std::atomic<std::size_t> gene_allocations{0};
+
+    /// @brief Allocator that counts how often chromosome storage is allocated.
+    template <typename T>
+    struct counting_allocator {
+        using value_type = T;
+
+        counting_allocator() = default;
+        template <typename U>
+        counting_allocator(const counting_allocator<U>&) {}
+
+        T* allocate(std::size_t size) {
+            ++gene_allocations;
+            return std::allocator<T>{}.allocate(size);
+        }
+        void deallocate(T* pointer, std::size_t size) {
+            std::allocator<T>{}.deallocate(pointer, size);
+        }
+
+        friend bool operator==(const counting_allocator&, const counting_allocator&) = default;
+    };
+}  // namespace
+
+TEST_CASE("Steady state generations do not allocate chromosome storage") {
+    using chromosome = std::vector<int, counting_allocator<int>>;
+    constexpr std::size_t generations = 20;
+    // 2 elites and 62 children keep the population at 64 individuals
+    const std::vector<chromosome> initial_population(64, chromosome{1, 2, 3, 4, 5, 6, 7, 8});
+    constexpr dp::genetic::algorithm_settings settings{.elitism_rate = 0.03,
+                                                       .crossover_rate = 0.48,
+                                                       .thread_count = 1,
+                                                       .seed = 7};
+
+    const auto run = [&](auto builder) {
+        const auto params =
+            builder
+                .with_fitness_operator([](const chromosome& value) {
+                    return static_cast<double>(std::accumulate(value.begin(), value.end(), 0));
+                })
+                .with_mutation_operator([](chromosome& value) { ++value.front(); })
+                // single point crossover that keeps the chromosome length
+                .with_crossover_operator(
+                    [](const chromosome& first, const chromosome& second, chromosome& child) {
+                        const auto pivot = static_cast<std::ptrdiff_t>(first.size() / 2);
+                        child.assign(first.begin(), first.begin() + pivot);
+                        child.insert(child.end(), second.begin() + pivot, second.end());
+                    })
+                .with_termination_operator(dp::genetic::generations_termination{generations})
+                .build();
+
+        std::vector<std::size_t> allocations{};
+        allocations.reserve(generations);
+        dp::genetic::solve(initial_population, settings, params,
+                           [&allocations](const auto& stats) {
+                               CHECK(stats.population_size == 64);
+                               allocations.push_back(gene_allocations.load());
+                           });
+        return allocations;
+    };
+
+    // both buffers are filled after the first two generations, after that every child reuses
+    // the storage of the chromosome it replaces
+    gene_allocations = 0;
+    const auto dynamic_allocations = run(dp::genetic::params<chromosome>::builder());
+    REQUIRE(dynamic_allocations.size() > 3);
+    CHECK(dynamic_allocations.back() == dynamic_allocations[2]);
+
+    gene_allocations = 0;
+    const auto static_allocations = run(dp::genetic::static_params<chromosome>::builder());
+    REQUIRE(static_allocations.size() > 3);
+    CHECK(static_allocations.back() == static_allocations[2]);
+}
+
+namespace {
+    /// @brief Memory resource that counts its allocations.
+    class counting_resource : public std::pmr::memory_resource {
+      public:
+        std::atomic<std::size_t> allocations{0};
+
+      private:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+            ++allocations;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+        void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override {
+            std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+        }
+        [[nodiscard]] bool do_is_equal(
+            const std::pmr::memory_resource& other) const noexcept override {
+            return this == &other;
+        }
+    };
+}  // namespace
+
+TEST_CASE("Solve with pmr chromosomes") {
+    const std::string alphabet = "abcdefghijklmnopqrstuvwxyz";
+    const std::string solution = "polymorphic allocators are fast";
+    constexpr std::size_t generations = 20;
+
+    const auto run = [&]<typename Chromosome>(std::type_identity<Chromosome>) {
+        const auto params =
+            typename dp::genetic::params<Chromosome>::builder()
+                .with_fitness_operator([&solution](const Chromosome& value) {
+                    double matches{};
+                    for (std::size_t i = 0; i < std::min(value.size(), solution.size()); ++i) {
+                        matches += value[i] == solution[i] ? 1.0 : 0.0;
+                    }
+                    return matches;
+                })
+                .with_mutation_operator(
+                    dp::genetic::value_replacement<
+                        Chromosome, dp::genetic::pooled_value_generator<std::string>>{
+                        dp::genetic::pooled_value_generator<std::string>{alphabet}})
+                .with_crossover_operator(dp::genetic::random_crossover{})
+                .with_termination_operator(dp::genetic::generations_termination{generations})
+                .build();
+
+        const std::vector<Chromosome> initial_population(100, Chromosome(solution.size(), 'a'));
+        std::vector<std::pair<std::string, double>> history{};
+        history.reserve(generations);
+        dp::genetic::solve(initial_population,
+                           dp::genetic::algorithm_settings{
+                               .elitism_rate = 0.1, .thread_count = 2, .seed = 5},
+                           params, [&history](const auto& stats) {
+                               history.emplace_back(std::string(stats.current_best.best),
+                                                    stats.current_best.fitness);
+                           });
+        return history;
+    };
+
+    const auto standard_history = run(std::type_identity<std::string>{});
+
+    // chromosomes are allocated from the arenas of solve(), the default resource is only used
+    // to keep track of the best chromosome
+    counting_resource counter{};
+    auto* const previous_resource = std::pmr::set_default_resource(&counter);
+    const auto pmr_history = run(std::type_identity<std::pmr::string>{});
+    std::pmr::set_default_resource(previous_resource);
+
+    CHECK(pmr_history == standard_history);
+    CHECK(counter.allocations.load() <= 102 + 2 * generations);
+}
+
+TEST_CASE("Fitness cache of a pmr solve outlives the generation arenas") {
+    const std::string solution(64, 'a');
+    constexpr std::size_t generations = 30;
+
+    const auto run = [&]<typename Chromosome>(std::type_identity<Chromosome>) {
+        const auto fitness = [&solution](const Chromosome& value) {
+            double matches{};
+            for (std::size_t i = 0; i < std::min(value.size(), solution.size()); ++i) {
+                matches += value[i] == solution[i] ? 1.0 : 0.0;
+            }
+            return matches;
+        };
+        const auto params =
+            typename dp::genetic::params<Chromosome>::builder()
+                .with_fitness_operator(fitness)
+                .with_mutation_operator(
+                    dp::genetic::value_replacement<
+                        Chromosome, dp::genetic::pooled_value_generator<std::string>>{
+                        dp::genetic::pooled_value_generator<std::string>{"ab"}})
+                .with_crossover_operator(dp::genetic::random_crossover{})
+                .with_termination_operator(dp::genetic::generations_termination{generations})
+                .build();
+
+        // long chromosomes make the arenas grow past one block, so they free memory on reset
+        std::vector<Chromosome> initial_population{};
+        for (std::size_t i = 0; i < 200; ++i) {
+            initial_population.emplace_back(40 + i % 20, i % 2 == 0 ? 'a' : 'b');
+        }
+        std::vector<std::pair<std::string, double>> history{};
+        std::size_t hits{0};
+        bool fitness_matches{true};
+        dp::genetic::solve(initial_population,
+                           dp::genetic::algorithm_settings{.elitism_rate = 0.1,
+                                                           .fitness_cache_capacity = 1'000,
+                                                           .thread_count = 1,
+                                                           .seed = 1},
+                           params, [&](const auto& stats) {
+                               history.emplace_back(std::string(stats.current_best.best),
+                                                    stats.current_best.fitness);
+                               hits += stats.fitness_cache_lookups.hits;
+                               fitness_matches = fitness_matches &&
+                                                 fitness(stats.current_best.best) ==
+                                                     stats.current_best.fitness;
+                           });
+        return std::tuple{history, hits, fitness_matches};
+    };
+
+    const auto [standard_history, standard_hits, standard_matches] =
+        run(std::type_identity<std::string>{});
+    const auto [pmr_history, pmr_hits, pmr_matches] = run(std::type_identity<std::pmr::string>{});
+
+    // cached keys of earlier generations are still found after their arenas were reset, also
+    // when they were stored in the slot of an evicted chromosome
+    CHECK(pmr_history == standard_history);
+    CHECK(pmr_hits == standard_hits);
+    CHECK(pmr_hits > 0);
+    CHECK(standard_matches);
+    CHECK(pmr_matches);
+}
+
+TEST_CASE("Population is sorted and elites are found through indices") {
+    std::vector<std::pair<std::string, double>> population{
+        {"c", 3.0}, {"a", 1.0}, {"e", 5.0}, {"b", 2.0}, {"d", 4.0}};
+
+    std::vector<std::size_t> elites{};
+    dp::genetic::details::elite_indices(population, 2, elites);
+    std::ranges::sort(elites);
+    CHECK(elites == std::vector<std::size_t>{2, 4});
+    // finding the elites does not reorder the population
+    CHECK(population.front().first == "c");
+
+    dp::genetic::details::elite_indices(population, 10, elites);
+    CHECK(elites.size() == population.size());
+
+    std::vector<std::size_t> order{};
+    dp::genetic::details::sort_by_fitness(population, order);
+    CHECK(std::ranges::equal(population | std::views::keys,
+                             std::vector<std::string>{"a", "b", "c", "d", "e"}));
+    CHECK(std::ranges::is_sorted(population, {}, &std::pair<std::string, double>::second));
+}
+
+TEST_CASE("Population is only sorted for selection operators that need it") {
+    const auto fitness = [](const std::string& value) {
+        return static_cast<double>(std::ranges::count(value, 'a'));
+    };
+    std::vector<std::string> initial_population{};
+    for (std::size_t i = 0; i < 50; ++i) initial_population.emplace_back(i % 7, 'a');
+
+    // operators that only accept chromosomes are given a population sorted by fitness
+    std::atomic<bool> sorted{true};
+    const auto legacy_selection =
+        [&](const std::vector<std::string>& population,
+            const auto& fitness_op) -> std::pair<std::string, std::string> {
+        if (!std::ranges::is_sorted(population, {}, fitness_op)) sorted = false;
+        return {population.front(), population.back()};
+    };
+    const auto params = dp::genetic::static_params<std::string>::builder()
+                            .with_fitness_operator(fitness)
+                            .with_selection_operator(legacy_selection)
+                            .with_termination_operator(dp::genetic::generations_termination{5})
+                            .build();
+    dp::genetic::solve(initial_population, dp::genetic::algorithm_settings{.thread_count = 1},
+                       params);
+    CHECK(sorted.load());
+
+    // the best chromosome never gets worse, whatever the order of the population
+    const auto [best, best_fitness] =
+        dp::genetic::solve(initial_population,
+                           dp::genetic::algorithm_settings{.elitism_rate = 0.1, .thread_count = 1},
+                           dp::genetic::static_params<std::string>::builder()
+                               .with_fitness_operator(fitness)
+                               .with_selection_operator(dp::genetic::tournament_selection{})
+                               .with_termination_operator(dp::genetic::generations_termination{5})
+                               .build());
+    CHECK(best_fitness >= 6.0);
+    CHECK(best_fitness == fitness(best));
+}
+
+TEST_CASE("Solve with an injected or inline executor") {
+    const auto fitness = [](const std::string& value) -> double {
+        return static_cast<double>(std::ranges::count(value, 'a'));
+    };
+    const std::vector<std::string> initial_population(50, "abcd");
+    const auto params = dp::genetic::params<std::string>::builder()
+                            .with_fitness_operator(fitness)
+                            .with_termination_operator(dp::genetic::generations_termination{5})
+                            .build();
+
+    // a pool owned by the caller
+    dp::thread_pool pool(2);
+    std::size_t generations{0};
+    dp::genetic::solve(pool, initial_population, dp::genetic::algorithm_settings{}, params,
+                       [&generations](const auto&) { ++generations; });
+    CHECK(generations == 4);
+
+    // single threaded mode runs everything on the calling thread
+    const auto caller = std::this_thread::get_id();
+    std::atomic<bool> other_thread_used{false};
+    const auto thread_checking_params =
+        dp::genetic::params<std::string>::builder()
+            .with_fitness_operator([&](const std::string& value) -> double {
+                if (std::this_thread::get_id() != caller) other_thread_used = true;
+                return fitness(value);
+            })
+            .with_termination_operator(dp::genetic::generations_termination{5})
+            .build();
+    dp::genetic::solve(initial_population, dp::genetic::algorithm_settings{.thread_count = 1},
+                       thread_checking_params);
+    CHECK_FALSE(other_thread_used.load());
+
+    dp::genetic::inline_executor executor{};
+    dp::genetic::solve(executor, initial_population, dp::genetic::algorithm_settings{},
+                       thread_checking_params);
+    CHECK_FALSE(other_thread_used.load());
+}
+
+TEST_CASE("Operators with synchronized state are shared by the worker threads") {
+    // the operators are shared by every task, so their state is guarded by a mutex or atomic
+    struct mutation_state {
+        std::mutex mutex;
+        std::mt19937 engine{7};
+        std::size_t calls{0};
+    };
+    const auto state = std::make_shared<mutation_state>();
+    const auto crossover_calls = std::make_shared<std::atomic<std::size_t>>(0);
+
+    const auto mutator = [state](std::string& value) {
+        std::scoped_lock lock(state->mutex);
+        ++state->calls;
+        std::uniform_int_distribution<std::size_t> position(0, value.size() - 1);
+        value[position(state->engine)] = 'a';
+    };
+    const auto crossover = [crossover_calls](const std::string& first, const std::string& second) {
+        crossover_calls->fetch_add(1);
+        return first.substr(0, first.size() / 2) + second.substr(first.size() / 2);
+    };
+    const auto fitness = [](const std::string& value) {
+        return static_cast<double>(std::ranges::count(value, 'a'));
+    };
+
+    constexpr std::size_t population_size = 64;
+    const std::vector<std::string> initial_population(population_size, "bbbbbbbb");
+    const auto run = [&](auto builder) {
+        state->calls = 0;
+        *crossover_calls = 0;
+        const auto params = builder.with_fitness_operator(fitness)
+                                .with_mutation_operator(mutator)
+                                .with_crossover_operator(crossover)
+                                .with_termination_operator(dp::genetic::generations_termination{10})
+                                .build();
+        std::size_t generations{0};
+        dp::genetic::solve(initial_population,
+                           dp::genetic::algorithm_settings{
+                               .mutation_rate = 1.0, .crossover_rate = 1.0, .thread_count = 4},
+                           params, [&generations](const auto&) { ++generations; });
+        REQUIRE(generations > 0);
+        // every child is crossed over and mutated exactly once
+        CHECK(state->calls == population_size * generations);
+        CHECK(crossover_calls->load() == population_size * generations);
+    };
+
+    run(dp::genetic::params<std::string>::builder());
+    run(dp::genetic::static_params<std::string>::builder());
+}
+
+TEST_CASE("Solve waits for every task before re-throwing an operator exception") {
+    constexpr std::size_t population_size = 64;
+    const std::vector<std::string> initial_population(population_size, "abcd");
+
+    // one evaluation of the first generation throws while the other tasks are still busy
+    std::atomic<std::size_t> calls{0};
+    std::atomic<std::size_t> running{0};
+    const auto fitness = [&](const std::string& value) -> double {
+        ++running;
+        const auto call = ++calls;
+        if (call == population_size + 1) {
+            --running;
+            throw std::runtime_error("fitness");
+        }
+        if (call > population_size) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        --running;
+        return static_cast<double>(std::ranges::count(value, 'a'));
+    };
+    const auto params = dp::genetic::params<std::string>::builder()
+                            .with_fitness_operator(fitness)
+                            .with_mutation_operator([](std::string& value) { value += 'a'; })
+                            .with_termination_operator(dp::genetic::generations_termination{5})
+                            .build();
+
+    dp::thread_pool pool(4);
+    CHECK_THROWS_AS(dp::genetic::solve(pool, initial_population,
+                                       dp::genetic::algorithm_settings{.mutation_rate = 1.0,
+                                                                       .chunk_size = 1},
+                                       params),
+                    std::runtime_error);
+    // no task still uses the locals of solve() once the exception reaches the caller
+    CHECK(running.load() == 0);
+    const auto calls_after_solve = calls.load();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    CHECK(calls.load() == calls_after_solve);
+}
+
+TEST_CASE("Seeded solves are reproducible") {
+    const std::string alphabet = "abcdefghijklmnopqrstuvwxyz";
+    const std::string solution = "reproducible";
+    const std::vector<std::string> initial_population(100, "aaaaaaaaaaaa");
+
+    const auto run = [&](std::uint_least64_t seed) {
+        const auto params =
+            dp::genetic::params<std::string>::builder()
+                .with_fitness_operator(dp::genetic::element_wise_comparison(solution, 1.0))
+                .with_mutation_operator(dp::genetic::composite_mutator{
+                    // crossover can produce empty children, give those a value to mutate
+                    [](const std::string& value) { return value.empty() ? "a" : value; },
+                    dp::genetic::value_replacement<
+                        std::string, dp::genetic::pooled_value_generator<std::string>>{
+                        dp::genetic::pooled_value_generator<std::string>{alphabet}}})
+                .with_crossover_operator(dp::genetic::random_crossover{})
+                .with_termination_operator(dp::genetic::generations_termination{20})
+                .build();
+
+        std::vector<std::pair<std::string, double>> history{};
+        dp::genetic::solve(initial_population,
+                           dp::genetic::algorithm_settings{
+                               .elitism_rate = 0.1, .thread_count = 3, .seed = seed},
+                           params, [&history](const auto& stats) {
+                               history.emplace_back(stats.current_best.best,
+                                                    stats.current_best.fitness);
+                           });
+        return history;
+    };
+
+    const auto first_run = run(1234);
+    const auto second_run = run(1234);
+    CHECK_FALSE(first_run.empty());
+    CHECK(first_run == second_run);
+}
+
+TEST_CASE("Solve with static params") {
+    const std::string alphabet = "abcdefghijklmnopqrstuvwxyz";
+    const std::string solution = "static";
+    const std::vector<std::string> initial_population(100, "aaaaaa");
+
+    // both builders have the same interface, only the type of the built parameters differs
+    const auto run = [&](auto builder) {
+        const auto params =
+            builder.with_fitness_operator(dp::genetic::element_wise_comparison(solution, 1.0))
+                .with_mutation_operator(dp::genetic::composite_mutator{
+                    [](const std::string& value) { return value.empty() ? "a" : value; },
+                    dp::genetic::value_replacement<
+                        std::string, dp::genetic::pooled_value_generator<std::string>>{
+                        dp::genetic::pooled_value_generator<std::string>{alphabet}}})
+                .with_crossover_operator(dp::genetic::random_crossover{})
+                .with_termination_operator(dp::genetic::generations_termination{20})
+                .build();
+
+        std::vector<std::pair<std::string, double>> history{};
+        dp::genetic::solve(
+            initial_population,
+            dp::genetic::algorithm_settings{.elitism_rate = 0.1, .thread_count = 2, .seed = 42},
+            params, [&history](const auto& stats) {
+                history.emplace_back(stats.current_best.best, stats.current_best.fitness);
+            });
+        return history;
+    };
+
+    const auto dynamic_run = run(dp::genetic::params<std::string>::builder());
+    const auto static_run = run(dp::genetic::static_params<std::string>::builder());
+    CHECK_FALSE(static_run.empty());
+    CHECK(static_run == dynamic_run);
+
+    // selection operators that only accept a population of chromosomes also work
+    const auto fitness = dp::genetic::element_wise_comparison(solution, 1.0);
+    const auto legacy_selection = [](const std::vector<std::string>& population,
+                                     const auto&) -> std::pair<std::string, std::string> {
+        return {population.front(), population.back()};
+    };
+    const auto params = dp::genetic::static_params<std::string>::builder()
+                            .with_fitness_operator(fitness)
+                            .with_selection_operator(legacy_selection)
+                            .with_termination_operator(dp::genetic::generations_termination{3})
+                            .build();
+    const auto [best, best_fitness] = dp::genetic::solve(
+        initial_population, dp::genetic::algorithm_settings{.thread_count = 1}, params);
+    CHECK(best_fitness == fitness(best));
+}
@@ -0,0 +1,67 @@
+#include <doctest/doctest.h>
+#include <genetic/details/memory.h>
+#include <genetic/mutation.h>
+
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <thread>
+#include <vector>
+
+static_assert(dp::genetic::type_traits::uses_memory_resource<std::pmr::string>);
+static_assert(dp::genetic::type_traits::uses_memory_resource<std::pmr::vector<int>>);
+static_assert(!dp::genetic::type_traits::uses_memory_resource<std::string>);
+static_assert(!dp::genetic::type_traits::uses_memory_resource<std::array<int, 4>>);
+
+TEST_CASE("Generation arena keeps its memory when it is reset") {
+    dp::genetic::generation_arena arena{};
+    const auto fill = [&arena] {
+        std::pmr::vector<std::pmr::string> values(&arena);
+        for (std::size_t i = 0; i < 1000; ++i) values.emplace_back(64, 'a');
+        CHECK(values.back().get_allocator().resource() == &arena);
+    };
+
+    fill();
+    const auto capacity = arena.capacity();
+    CHECK(capacity > 1000 * 64);
+
+    // the same allocations after a reset fit in the memory the arena already has
+    arena.reset();
+    fill();
+    CHECK(arena.capacity() == capacity);
+}
+
+TEST_CASE("Generation arena is shared by multiple threads") {
+    dp::genetic::generation_arena arena{};
+    std::pmr::vector<std::pmr::vector<int>> values(&arena);
+    values.resize(4);
+
+    std::vector<std::thread> threads{};
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        threads.emplace_back([&values, i] {
+            for (int value = 0; value < 10000; ++value) values[i].push_back(value);
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    for (const auto& value : values) {
+        REQUIRE(value.size() == 10000);
+        CHECK(value.back() == 9999);
+    }
+    // all the values share the resource, so they can be swapped
+    std::ranges::swap(values[0], values[1]);
+    CHECK(values[0].get_allocator() == values[1].get_allocator());
+}
+
+TEST_CASE("Copies made by mutation operators keep the allocator") {
+    std::pmr::monotonic_buffer_resource resource{};
+    const std::pmr::string value(64, 'a', &resource);
+
+    const auto copy = dp::genetic::details::copy_of(value);
+    CHECK(copy == value);
+    CHECK(copy.get_allocator().resource() == &resource);
+    CHECK(dp::genetic::details::empty_like(value).get_allocator().resource() == &resource);
+
+    const auto mutated = dp::genetic::mutate(dp::genetic::no_op_mutator{}, value);
+    CHECK(mutated.get_allocator().resource() == &resource);
+}
@@ -1,7 +1,10 @@
 #include <doctest/doctest.h>
 #include <genetic/mutation.h>
 
+#include <algorithm>
 #include <iostream>
+#include <string>
+#include <vector>
 
 static_assert(dp::genetic::concepts::mutation_operator<dp::genetic::no_op_mutator, std::string>);
 static_assert(dp::genetic::concepts::mutation_operator<dp::genetic::no_op_mutator, int>);
@@ -97,3 +100,51 @@ TEST_CASE("Value mutator") {
         CHECK(std::abs(new_value_array[i] - xy_array[i]) <= 0.1);
     }
 }
+
+// built-in mutators work both in place and by value
+static_assert(dp::genetic::concepts::in_place_mutation_operator<dp::genetic::no_op_mutator,
+                                                                std::string>);
+static_assert(dp::genetic::concepts::in_place_mutation_operator<
+              dp::genetic::details::value_mutation_op<double>, std::vector<double>>);
+static_assert(dp::genetic::concepts::mutation_operator<
+              dp::genetic::details::value_mutation_op<double>, std::vector<double>>);
+
+// only the no-op mutator reports that it never changes a chromosome
+static_assert(!dp::genetic::details::mutation_modifies_chromosome<dp::genetic::no_op_mutator>());
+static_assert(dp::genetic::details::mutation_modifies_chromosome<
+              dp::genetic::details::value_mutation_op<double>>());
+
+TEST_CASE("In place mutation") {
+    const auto append = [](std::string& value) { value += "!"; };
+    static_assert(dp::genetic::concepts::in_place_mutation_operator<decltype(append), std::string>);
+    static_assert(!dp::genetic::concepts::mutation_operator<decltype(append), std::string>);
+
+    // mutate() returns a mutated copy, the input is left alone
+    const std::string input = "test";
+    CHECK_EQ(dp::genetic::mutate(append, input), "test!");
+    CHECK_EQ(input, "test");
+
+    // mutate_in_place() works with both kinds of operators
+    std::string value = "test";
+    dp::genetic::mutate_in_place(append, value);
+    dp::genetic::mutate_in_place([](const std::string& s) { return s + "?"; }, value);
+    CHECK_EQ(value, "test!?");
+
+    // the built-in mutators modify lvalues in place
+    const auto double_value_mutator = dp::genetic::double_value_mutator(1.0, 2.0);
+    std::vector values{0.0, 0.0, 0.0};
+    const auto* data = values.data();
+    double_value_mutator(values);
+    CHECK(values.data() == data);
+    CHECK(std::ranges::all_of(values, [](double v) { return v >= 1.0 && v <= 2.0; }));
+
+    // composite mutators chain in place and value returning operators
+    dp::genetic::composite_mutator mutator{
+        [](std::string& s) { s += "part1"; },
+        [](const std::string& s) { return s + "part2"; },
+        [](std::string& s) { s += "part3"; }};
+    std::string composite_value = "test";
+    mutator(composite_value);
+    CHECK_EQ(composite_value, "testpart1part2part3");
+    CHECK_EQ(dp::genetic::mutate(mutator, input), "testpart1part2part3");
+}
@@ -20,3 +20,96 @@ TEST_CASE("Create params with builder") {
 
     CHECK(genetic_params.fitness_operator()("") == 0.0);
 }
+
+TEST_CASE("Create static params with builder") {
+    const auto fitness = [](const std::string& value) { return static_cast<double>(value.size()); };
+    const auto genetic_params = dp::genetic::static_params<std::string>::builder()
+                                    .with_fitness_operator(fitness)
+                                    .with_mutation_operator(dp::genetic::no_op_mutator{})
+                                    .with_termination_operator(
+                                        dp::genetic::generations_termination{10})
+                                    .build();
+
+    // the operators keep their own type instead of being wrapped in std::function
+    static_assert(std::is_same_v<std::remove_cvref_t<decltype(genetic_params.fitness_operator())>,
+                                 std::remove_cvref_t<decltype(fitness)>>);
+    static_assert(std::is_same_v<std::remove_cvref_t<decltype(genetic_params.crossover_operator())>,
+                                 dp::genetic::random_crossover>);
+    CHECK(genetic_params.fitness_operator()("abc") == 3.0);
+    CHECK(genetic_params.mutation_operator()(std::string("abc")) == "abc");
+}
+
+namespace {
+    double length_fitness(const std::string& value) { return static_cast<double>(value.size()); }
+}  // namespace
+
+TEST_CASE("Params accept free functions as fitness operators") {
+    const auto genetic_params =
+        dp::genetic::params<std::string>::builder().with_fitness_operator(length_fitness).build();
+    CHECK(genetic_params.fitness_operator()("abc") == 3.0);
+
+    // functions are stored as function pointers
+    const auto static_genetic_params =
+        dp::genetic::static_params<std::string>::builder()
+            .with_fitness_operator(length_fitness)
+            .build();
+    static_assert(
+        std::is_same_v<std::remove_cvref_t<decltype(static_genetic_params.fitness_operator())>,
+                       double (*)(const std::string&)>);
+    CHECK(static_genetic_params.fitness_operator()("abcd") == 4.0);
+}
+
+TEST_CASE("Params accept in place mutation operators") {
+    const auto genetic_params =
+        dp::genetic::params<std::string>::builder()
+            .with_mutation_operator([](std::string& value) { value += "!"; })
+            .build();
+    CHECK(genetic_params.mutation_operator()("abc") == "abc!");
+
+    const auto static_genetic_params =
+        dp::genetic::static_params<std::string>::builder()
+            .with_mutation_operator([](std::string& value) { value += "!"; })
+            .build();
+    std::string value = "abc";
+    dp::genetic::mutate_in_place(static_genetic_params.mutation_operator(), value);
+    CHECK(value == "abc!");
+}
+
+namespace {
+    /// @brief Generic selection operator that asks for a sorted population.
+    struct sorted_selection {
+        static constexpr bool requires_sorted_population = true;
+
+        template <std::ranges::random_access_range Range, typename UnaryOperator,
+                  typename T = std::ranges::range_value_t<Range>>
+        std::pair<T, T> operator()(Range&& population, UnaryOperator) const {
+            return {population.front(), population.back()};
+        }
+    };
+}  // namespace
+
+TEST_CASE("Params know when the population has to be sorted") {
+    using params = dp::genetic::params<std::string>;
+    CHECK_FALSE(params::builder().build().requires_sorted_population());
+    CHECK_FALSE(params::builder()
+                    .with_selection_operator<dp::genetic::details::accumulation_fitness_op>(
+                        dp::genetic::tournament_selection{})
+                    .build()
+                    .requires_sorted_population());
+    CHECK(params::builder()
+              .with_selection_operator<dp::genetic::details::accumulation_fitness_op>(
+                  sorted_selection{})
+              .build()
+              .requires_sorted_population());
+
+    // operators that only accept chromosomes keep getting a sorted population
+    const auto legacy_selection = [](const std::vector<std::string>& population,
+                                     const auto&) -> std::pair<std::string, std::string> {
+        return {population.front(), population.back()};
+    };
+    using static_params = dp::genetic::static_params<std::string>;
+    static_assert(!static_params::requires_sorted_population());
+    static_assert(decltype(static_params::builder()
+                               .with_selection_operator(legacy_selection)
+                               .build())::requires_sorted_population());
+}
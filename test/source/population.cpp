@@ -0,0 +1,66 @@
+#include <doctest/doctest.h>
+#include <genetic/details/concepts.h>
+#include <genetic/fitness.h>
+#include <genetic/population.h>
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+using fixed_population = dp::genetic::population_matrix<double, 3>;
+using dynamic_population = dp::genetic::population_matrix<double>;
+
+// the rows of the matrix can be used wherever a population is expected
+static_assert(dp::genetic::concepts::population<decltype(std::declval<fixed_population&>().rows()),
+                                                std::span<double, 3>>);
+static_assert(dp::genetic::concepts::population<
+              decltype(std::declval<const dynamic_population&>().rows()), std::span<const double>>);
+static_assert(std::ranges::random_access_range<decltype(std::declval<fixed_population&>().rows())>);
+
+TEST_CASE("Population matrix stores genes contiguously") {
+    const std::vector<std::array<double, 3>> chromosomes{{1, 2, 3}, {4, 5, 6}, {7, 8, 9}};
+    fixed_population population(chromosomes);
+
+    REQUIRE(population.size() == 3);
+    CHECK(population.gene_count() == 3);
+    CHECK(std::ranges::equal(population.genes(), std::array{1., 2., 3., 4., 5., 6., 7., 8., 9.}));
+    CHECK(reinterpret_cast<std::uintptr_t>(population.genes().data()) % 64 == 0);
+    CHECK(std::ranges::equal(population[1], chromosomes[1]));
+
+    // rows are views into the matrix
+    population[2][0] = 10.0;
+    CHECK(population.genes()[6] == 10.0);
+
+    const dynamic_population dynamic(std::vector<std::vector<double>>{{1, 2}, {3, 4}});
+    CHECK(dynamic.size() == 2);
+    CHECK(dynamic.gene_count() == 2);
+    CHECK(std::ranges::equal(dynamic[1], std::array{3., 4.}));
+}
+
+TEST_CASE("Population matrix orders indices instead of chromosomes") {
+    fixed_population population(
+        std::vector<std::array<double, 3>>{{1, 1, 1}, {3, 3, 3}, {0, 0, 0}, {2, 2, 2}});
+    population.evaluate(dp::genetic::accumulation_fitness);
+    CHECK(std::ranges::equal(population.fitness(), std::array{3., 9., 0., 6.}));
+
+    const auto order = population.order();
+    CHECK(order == std::vector<std::size_t>{1, 3, 0, 2});
+    // ordering does not move the rows
+    CHECK(population[0][0] == 1.0);
+
+    CHECK(population.best(2) == std::vector<std::size_t>{1, 3});
+    CHECK(population.best(10).size() == 4);
+
+    // permuting moves the rows and their fitness together
+    population.permute(order);
+    CHECK(std::ranges::equal(population.fitness(), std::array{9., 6., 3., 0.}));
+    CHECK(population[0][0] == 3.0);
+    CHECK(population[3][0] == 0.0);
+
+    // a subset of the rows, i.e. keep only the elites
+    const auto elites = population.best(2);
+    population.permute(elites);
+    CHECK(population.size() == 2);
+    CHECK(std::ranges::equal(population.fitness(), std::array{9., 6.}));
+}
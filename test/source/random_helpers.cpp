@@ -1,5 +1,105 @@
+#include <doctest/doctest.h>
 #include <genetic/details/concepts.h>
 #include <genetic/details/random_helpers.h>
+#include <genetic/op/crossover/random_crossover.h>
+#include <genetic/op/mutation/value_mutation.h>
+#include <genetic/op/selection/tournament_selection.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
 
 // index generator concept
 static_assert(dp::genetic::concepts::index_generator<dp::genetic::uniform_integral_generator>);
+static_assert(dp::genetic::concepts::index_generator<
+              dp::genetic::basic_uniform_integral_generator<dp::genetic::xoshiro256pp>>);
+
+// random engines
+static_assert(std::uniform_random_bit_generator<dp::genetic::xoshiro256pp>);
+static_assert(std::uniform_random_bit_generator<dp::genetic::philox4x32>);
+
+TEST_CASE("xoshiro256++ is deterministic") {
+    dp::genetic::xoshiro256pp first{42};
+    dp::genetic::xoshiro256pp second{42};
+    for (int i = 0; i < 100; ++i) CHECK(first() == second());
+
+    dp::genetic::xoshiro256pp jumped{42};
+    jumped.jump();
+    CHECK(jumped != first);
+
+    std::seed_seq seeds{1, 2, 3};
+    std::seed_seq same_seeds{1, 2, 3};
+    CHECK(dp::genetic::xoshiro256pp{seeds} == dp::genetic::xoshiro256pp{same_seeds});
+}
+
+TEST_CASE("Philox4x32-10 known answers") {
+    using philox = dp::genetic::philox4x32;
+    // known answer tests from the Random123 distribution
+    CHECK(philox::generate_block({0, 0, 0, 0}, {0, 0}) ==
+          philox::counter_type{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8});
+    CHECK(philox::generate_block({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344},
+                                 {0xa4093822, 0x299f31d0}) ==
+          philox::counter_type{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1});
+
+    philox engine{0};
+    CHECK(engine() == 0x6627e8d5);
+    CHECK(engine() == 0xe169c58d);
+    CHECK(engine() == 0xbc57ac4c);
+    CHECK(engine() == 0x9b00dbd8);
+
+    philox first{7, 1};
+    philox second{7, 2};
+    CHECK(first() != second());
+}
+
+TEST_CASE("Generators with a custom random engine") {
+    using dp::genetic::xoshiro256pp;
+    const auto generator = dp::genetic::basic_uniform_integral_generator<xoshiro256pp>{};
+    for (int i = 0; i < 100; ++i) {
+        const auto value = generator(3, 9);
+        CHECK(value >= 3);
+        CHECK(value <= 9);
+    }
+
+    const auto draw = [] {
+        dp::genetic::details::random_stream_scope scope(1234, 1);
+        std::vector<double> values;
+        const auto real_generator =
+            dp::genetic::basic_uniform_floating_point_generator<dp::genetic::philox4x32>{};
+        for (int i = 0; i < 10; ++i) values.push_back(real_generator(0.0, 1.0));
+        return values;
+    };
+    CHECK(draw() == draw());
+
+    // once the scope ends the engine no longer continues the seeded stream
+    const auto draw_after_scope = [&draw] {
+        static_cast<void>(draw());
+        return dp::genetic::basic_uniform_integral_generator<dp::genetic::philox4x32>{}(
+            std::uint64_t{0}, std::numeric_limits<std::uint64_t>::max());
+    };
+    CHECK(draw_after_scope() != draw_after_scope());
+
+    const std::string parent1 = "abcdefgh";
+    const std::string parent2 = "ABCDEFGH";
+    dp::genetic::basic_random_crossover<
+        dp::genetic::basic_uniform_integral_generator<xoshiro256pp>>
+        crossover{};
+    const auto child = crossover(parent1, parent2);
+    CHECK(child.size() <= parent1.size() + parent2.size());
+    CHECK(std::ranges::all_of(child, [&](char value) {
+        return parent1.find(value) != std::string::npos || parent2.find(value) != std::string::npos;
+    }));
+
+    const auto mutator = dp::genetic::double_value_mutator<xoshiro256pp>(-0.5, 0.5);
+    const std::vector<double> chromosome(10, 0.5);
+    const auto mutated = mutator(chromosome);
+    CHECK(std::ranges::all_of(mutated, [](double value) { return value >= 0.0 && value <= 1.0; }));
+
+    const auto selection = dp::genetic::basic_tournament_selection<xoshiro256pp>{3};
+    const std::vector<int> population{1, 2, 3, 4};
+    const auto [first, second] = selection(population, [](int value) { return value; });
+    CHECK(std::ranges::find(population, first) != population.end());
+    CHECK(std::ranges::find(population, second) != population.end());
+}
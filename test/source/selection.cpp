@@ -128,3 +128,119 @@ TEST_CASE("Rank selection with ranges::view") {
     CHECK(string_value == "tesa");
     CHECK(min_value == "bbb");
 }
+
+TEST_CASE("Roulette selection with cached fitness") {
+    using scored = std::pair<std::string, double>;
+    // fitness is already cached with each chromosome, so no fitness operator is needed
+    const std::vector<scored> population{
+        {"tesa", 3.0}, {"aaaa", 0.0}, {"bbbb", 0.0}, {"aaa", 0.0}, {"bbb", 0.0}};
+
+    dp::genetic::roulette_selection selection{};
+    for (auto i = 0; i < 100; ++i) {
+        // only the member with a non-zero fitness can be selected
+        const auto [parent1, parent2] = dp::genetic::select_parents(selection, population);
+        CHECK(parent1 == "tesa");
+        CHECK(parent2 == "tesa");
+    }
+}
+
+static_assert(dp::genetic::concepts::prepared_selection_operator<
+              dp::genetic::roulette_selection, const std::vector<std::string>&,
+              double (*)(const std::string&)>);
+
+TEST_CASE("Roulette selection prepared once for many draws") {
+    const std::string test_value = "test";
+    const std::vector<std::string> population{"tesa", "aaaa", "bbbb", "aaa", "bbb"};
+    const auto fitness_op = [&test_value](const std::string& value) -> double {
+        double score = 0.0;
+        for (std::size_t i = 0; i < std::min(test_value.size(), value.size()); i++) {
+            score += test_value[i] == value[i];
+        }
+        return score;
+    };
+
+    dp::genetic::roulette_selection selection{};
+    const auto sampler = dp::genetic::prepare_selection(selection, population, fitness_op);
+
+    // "tesa" is the only member with a non-zero fitness
+    for (auto i = 0; i < 100; ++i) {
+        const auto [first, second] = sampler();
+        CHECK(first == 0);
+        CHECK(second == 0);
+    }
+
+    // matches the linear walk when the cached fitness is used
+    using scored = std::pair<std::string, double>;
+    const std::vector<scored> scored_population{
+        {"aaaa", 0.0}, {"bbbb", 1.0}, {"tesa", 0.0}, {"aaa", 0.0}, {"bbb", 1.0}};
+    const auto scored_sampler = dp::genetic::prepare_selection(selection, scored_population);
+    for (auto i = 0; i < 100; ++i) {
+        const auto [first, second] = scored_sampler();
+        CHECK((first == 1 || first == 4));
+        CHECK((second == 1 || second == 4));
+    }
+}
+
+TEST_CASE("Rank selection ranks by fitness instead of position") {
+    using scored = std::pair<std::string, double>;
+    // sorted with the lowest fitness first, the same order solve() keeps its population in
+    std::vector<scored> population{};
+    for (auto i = 0; i < 1000; ++i) population.emplace_back(std::to_string(i), i);
+
+    dp::genetic::rank_selection selector{};
+    const auto sampler = dp::genetic::prepare_selection(selector, population);
+
+    std::size_t upper_half_count{0};
+    constexpr auto draws = 1000;
+    for (auto i = 0; i < draws; ++i) {
+        const auto [first, second] = sampler();
+        upper_half_count += first >= 500;
+        upper_half_count += second >= 500;
+    }
+
+    // the upper half holds 75% of the total rank weight
+    CHECK(upper_half_count > draws);
+
+    const auto weights = dp::genetic::details::rank_weights({1.0, 3.0, 2.0, 3.0});
+    CHECK(weights == std::vector{1.0, 4.0, 2.0, 3.0});
+}
+
+static_assert(dp::genetic::concepts::selection_operator<dp::genetic::tournament_selection,
+                                                        std::string, std::vector<std::string>,
+                                                        double (*)(const std::string&)>);
+static_assert(dp::genetic::concepts::prepared_selection_operator<
+              dp::genetic::tournament_selection, const std::vector<std::string>&,
+              double (*)(const std::string&)>);
+
+TEST_CASE("Tournament selection") {
+    const std::string test_value = "test";
+    const std::vector<std::string> initial_population{"tesa", "aaaa", "bbbb", "aaa", "bbb"};
+
+    dp::genetic::tournament_selection selector{3};
+    const auto selection_histogram = test_selection(selector, test_value, initial_population);
+
+    constexpr auto comp_op = [](auto first, auto second) { return first.second < second.second; };
+    const auto [string_value, count] = *std::ranges::max_element(selection_histogram, comp_op);
+    CHECK(string_value == "tesa");
+
+    // a tournament of size 1 is a uniform random pick, any member can be selected
+    using scored = std::pair<std::string, double>;
+    const std::vector<scored> population{{"a", 0.0}, {"b", 1.0}, {"c", 2.0}};
+    const auto uniform_sampler =
+        dp::genetic::prepare_selection(dp::genetic::tournament_selection{1}, population);
+    // a tournament as large as the population almost always finds the best member
+    const auto greedy_sampler =
+        dp::genetic::prepare_selection(dp::genetic::tournament_selection{100}, population);
+    std::vector<int> uniform_counts(population.size(), 0);
+    for (auto i = 0; i < 300; ++i) {
+        const auto [first, second] = uniform_sampler();
+        ++uniform_counts[first];
+        ++uniform_counts[second];
+        CHECK(greedy_sampler().first == 2);
+    }
+    CHECK(std::ranges::all_of(uniform_counts, [](int count) { return count > 0; }));
+
+    const auto [parent1, parent2] = dp::genetic::select_parents(selector, population);
+    CHECK(!parent1.empty());
+    CHECK(!parent2.empty());
+}